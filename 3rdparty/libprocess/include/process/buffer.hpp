@@ -0,0 +1,94 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#ifndef __PROCESS_BUFFER_HPP__
+#define __PROCESS_BUFFER_HPP__
+
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+
+namespace process {
+
+// An immutable, reference counted string of bytes (e.g., the body of
+// a `Message`). Copying a buffer only copies the reference, so the
+// bytes received for a message can be passed along and parsed without
+// being copied again.
+//
+// NOTE: A buffer implicitly converts to `const std::string&` so that
+// it can be used wherever a `std::string` was used before.
+class Buffer
+{
+public:
+  Buffer() = default;
+
+  // Takes ownership of the string; pass an rvalue to avoid a copy.
+  Buffer(std::string data)
+    : bytes(std::make_shared<const std::string>(std::move(data))) {}
+
+  Buffer(const char* data) : Buffer(std::string(data)) {}
+
+  Buffer(const char* data, size_t size) : Buffer(std::string(data, size)) {}
+
+  const std::string& get() const
+  {
+    static const std::string* empty = new std::string();
+
+    return bytes ? *bytes : *empty;
+  }
+
+  operator const std::string&() const
+  {
+    return get();
+  }
+
+  const char* data() const
+  {
+    return get().data();
+  }
+
+  size_t size() const
+  {
+    return get().size();
+  }
+
+  bool empty() const
+  {
+    return get().empty();
+  }
+
+private:
+  std::shared_ptr<const std::string> bytes;
+};
+
+
+inline bool operator==(const Buffer& left, const Buffer& right)
+{
+  return left.get() == right.get();
+}
+
+
+inline bool operator!=(const Buffer& left, const Buffer& right)
+{
+  return !(left == right);
+}
+
+
+inline std::ostream& operator<<(std::ostream& stream, const Buffer& buffer)
+{
+  return stream << buffer.get();
+}
+
+} // namespace process {
+
+#endif // __PROCESS_BUFFER_HPP__
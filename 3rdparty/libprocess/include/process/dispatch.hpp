@@ -60,11 +60,11 @@ namespace internal {
 // this routine does not expect anything in particular about the
 // specified function (second argument). The semantics are simple: the
 // function gets applied/invoked with the process as its first
-// argument. Currently we wrap the function in a shared_ptr but this
-// will probably change in the future to unique_ptr (or a variant).
+// argument. The function is moved into the `DispatchEvent` so a
+// small enough function doesn't need an allocation of its own.
 void dispatch(
     const UPID& pid,
-    const std::shared_ptr<std::function<void(ProcessBase*)>>& f,
+    std::function<void(ProcessBase*)>&& f,
     const Option<const std::type_info*>& functionType = None());
 
 
@@ -84,13 +84,12 @@ struct Dispatch<void>
   template <typename F>
   void operator()(const UPID& pid, F&& f)
   {
-    std::shared_ptr<std::function<void(ProcessBase*)>> f_(
-        new std::function<void(ProcessBase*)>(
-            [=](ProcessBase*) {
-              f();
-            }));
+    std::function<void(ProcessBase*)> f_(
+        [=](ProcessBase*) {
+          f();
+        });
 
-    internal::dispatch(pid, f_);
+    internal::dispatch(pid, std::move(f_));
   }
 };
 
@@ -107,13 +106,12 @@ struct Dispatch<Future<R>>
   {
     std::shared_ptr<Promise<R>> promise(new Promise<R>());
 
-    std::shared_ptr<std::function<void(ProcessBase*)>> f_(
-        new std::function<void(ProcessBase*)>(
-            [=](ProcessBase*) {
-              promise->associate(f());
-            }));
+    std::function<void(ProcessBase*)> f_(
+        [=](ProcessBase*) {
+          promise->associate(f());
+        });
 
-    internal::dispatch(pid, f_);
+    internal::dispatch(pid, std::move(f_));
 
     return promise->future();
   }
@@ -131,13 +129,12 @@ struct Dispatch
   {
     std::shared_ptr<Promise<R>> promise(new Promise<R>());
 
-    std::shared_ptr<std::function<void(ProcessBase*)>> f_(
-        new std::function<void(ProcessBase*)>(
-            [=](ProcessBase*) {
-              promise->set(f());
-            }));
+    std::function<void(ProcessBase*)> f_(
+        [=](ProcessBase*) {
+          promise->set(f());
+        });
 
-    internal::dispatch(pid, f_);
+    internal::dispatch(pid, std::move(f_));
 
     return promise->future();
   }
@@ -157,16 +154,15 @@ struct Dispatch
 template <typename T>
 void dispatch(const PID<T>& pid, void (T::*method)())
 {
-  std::shared_ptr<std::function<void(ProcessBase*)>> f(
-      new std::function<void(ProcessBase*)>(
-          [=](ProcessBase* process) {
-            assert(process != nullptr);
-            T* t = dynamic_cast<T*>(process);
-            assert(t != nullptr);
-            (t->*method)();
-          }));
-
-  internal::dispatch(pid, f, &typeid(method));
+  std::function<void(ProcessBase*)> f(
+      [=](ProcessBase* process) {
+        assert(process != nullptr);
+        T* t = dynamic_cast<T*>(process);
+        assert(t != nullptr);
+        (t->*method)();
+      });
+
+  internal::dispatch(pid, std::move(f), &typeid(method));
 }
 
 template <typename T>
@@ -198,19 +194,18 @@ void dispatch(const Process<T>* process, void (T::*method)())
       void (T::*method)(ENUM_PARAMS(N, P)),                             \
       ENUM_BINARY_PARAMS(N, A, &&a))                                    \
   {                                                                     \
-    std::shared_ptr<std::function<void(ProcessBase*)>> f(               \
-        new std::function<void(ProcessBase*)>(                          \
-            std::bind([method](ENUM(N, DECL, _),                        \
-                               ProcessBase* process) {                  \
-                        assert(process != nullptr);                     \
-                        T* t = dynamic_cast<T*>(process);               \
-                        assert(t != nullptr);                           \
-                        (t->*method)(ENUM_PARAMS(N, a));                \
-                      },                                                \
-                      ENUM(N, FORWARD, _),                              \
-                      lambda::_1)));                                    \
+    std::function<void(ProcessBase*)> f(                                \
+        std::bind([method](ENUM(N, DECL, _),                            \
+                           ProcessBase* process) {                      \
+                    assert(process != nullptr);                         \
+                    T* t = dynamic_cast<T*>(process);                   \
+                    assert(t != nullptr);                               \
+                    (t->*method)(ENUM_PARAMS(N, a));                    \
+                  },                                                    \
+                  ENUM(N, FORWARD, _),                                  \
+                  lambda::_1));                                         \
                                                                         \
-    internal::dispatch(pid, f, &typeid(method));                        \
+    internal::dispatch(pid, std::move(f), &typeid(method));             \
   }                                                                     \
                                                                         \
   template <typename T,                                                 \
@@ -246,16 +241,15 @@ Future<R> dispatch(const PID<T>& pid, Future<R> (T::*method)())
 {
   std::shared_ptr<Promise<R>> promise(new Promise<R>());
 
-  std::shared_ptr<std::function<void(ProcessBase*)>> f(
-      new std::function<void(ProcessBase*)>(
-          [=](ProcessBase* process) {
-            assert(process != nullptr);
-            T* t = dynamic_cast<T*>(process);
-            assert(t != nullptr);
-            promise->associate((t->*method)());
-          }));
+  std::function<void(ProcessBase*)> f(
+      [=](ProcessBase* process) {
+        assert(process != nullptr);
+        T* t = dynamic_cast<T*>(process);
+        assert(t != nullptr);
+        promise->associate((t->*method)());
+      });
 
-  internal::dispatch(pid, f, &typeid(method));
+  internal::dispatch(pid, std::move(f), &typeid(method));
 
   return promise->future();
 }
@@ -284,20 +278,19 @@ Future<R> dispatch(const Process<T>* process, Future<R> (T::*method)())
   {                                                                     \
     std::shared_ptr<Promise<R>> promise(new Promise<R>());              \
                                                                         \
-    std::shared_ptr<std::function<void(ProcessBase*)>> f(               \
-        new std::function<void(ProcessBase*)>(                          \
-            std::bind([promise, method](ENUM(N, DECL, _),               \
-                                        ProcessBase* process) {         \
-                        assert(process != nullptr);                     \
-                        T* t = dynamic_cast<T*>(process);               \
-                        assert(t != nullptr);                           \
-                        promise->associate(                             \
-                            (t->*method)(ENUM_PARAMS(N, a)));           \
-                      },                                                \
-                      ENUM(N, FORWARD, _),                              \
-                      lambda::_1)));                                    \
+    std::function<void(ProcessBase*)> f(                                \
+        std::bind([promise, method](ENUM(N, DECL, _),                   \
+                                    ProcessBase* process) {             \
+                    assert(process != nullptr);                         \
+                    T* t = dynamic_cast<T*>(process);                   \
+                    assert(t != nullptr);                               \
+                    promise->associate(                                 \
+                        (t->*method)(ENUM_PARAMS(N, a)));               \
+                  },                                                    \
+                  ENUM(N, FORWARD, _),                                  \
+                  lambda::_1));                                         \
                                                                         \
-    internal::dispatch(pid, f, &typeid(method));                        \
+    internal::dispatch(pid, std::move(f), &typeid(method));             \
                                                                         \
     return promise->future();                                           \
   }                                                                     \
@@ -337,16 +330,15 @@ Future<R> dispatch(const PID<T>& pid, R (T::*method)())
 {
   std::shared_ptr<Promise<R>> promise(new Promise<R>());
 
-  std::shared_ptr<std::function<void(ProcessBase*)>> f(
-      new std::function<void(ProcessBase*)>(
-          [=](ProcessBase* process) {
-            assert(process != nullptr);
-            T* t = dynamic_cast<T*>(process);
-            assert(t != nullptr);
-            promise->set((t->*method)());
-          }));
+  std::function<void(ProcessBase*)> f(
+      [=](ProcessBase* process) {
+        assert(process != nullptr);
+        T* t = dynamic_cast<T*>(process);
+        assert(t != nullptr);
+        promise->set((t->*method)());
+      });
 
-  internal::dispatch(pid, f, &typeid(method));
+  internal::dispatch(pid, std::move(f), &typeid(method));
 
   return promise->future();
 }
@@ -375,19 +367,18 @@ Future<R> dispatch(const Process<T>* process, R (T::*method)())
   {                                                                     \
     std::shared_ptr<Promise<R>> promise(new Promise<R>());              \
                                                                         \
-    std::shared_ptr<std::function<void(ProcessBase*)>> f(               \
-        new std::function<void(ProcessBase*)>(                          \
-            std::bind([promise, method](ENUM(N, DECL, _),               \
-                                        ProcessBase* process) {         \
-                        assert(process != nullptr);                     \
-                        T* t = dynamic_cast<T*>(process);               \
-                        assert(t != nullptr);                           \
-                        promise->set((t->*method)(ENUM_PARAMS(N, a)));  \
-                      },                                                \
-                      ENUM(N, FORWARD, _),                              \
-                      lambda::_1)));                                    \
+    std::function<void(ProcessBase*)> f(                                \
+        std::bind([promise, method](ENUM(N, DECL, _),                   \
+                                    ProcessBase* process) {             \
+                    assert(process != nullptr);                         \
+                    T* t = dynamic_cast<T*>(process);                   \
+                    assert(t != nullptr);                               \
+                    promise->set((t->*method)(ENUM_PARAMS(N, a)));      \
+                  },                                                    \
+                  ENUM(N, FORWARD, _),                                  \
+                  lambda::_1));                                         \
                                                                         \
-    internal::dispatch(pid, f, &typeid(method));                        \
+    internal::dispatch(pid, std::move(f), &typeid(method));             \
                                                                         \
     return promise->future();                                           \
   }                                                                     \
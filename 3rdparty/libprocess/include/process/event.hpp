@@ -13,6 +13,7 @@
 #ifndef __PROCESS_EVENT_HPP__
 #define __PROCESS_EVENT_HPP__
 
+#include <chrono>
 #include <memory> // TODO(benh): Replace shared_ptr with unique_ptr.
 
 #include <process/future.hpp>
@@ -50,6 +51,17 @@ struct Event
 {
   virtual ~Event() {}
 
+  // Events are allocated and freed on the hot path of every dispatch,
+  // message and request, so they are recycled through per-thread
+  // pools rather than always going to the heap (see process.cpp).
+  static void* operator new(size_t size);
+  static void operator delete(void* event, size_t size);
+
+  // Declaring the above hides the global placement forms (e.g., used
+  // by `Option<MessageEvent>`), so we need to provide them here.
+  static void* operator new(size_t, void* place) { return place; }
+  static void operator delete(void*, void*) {}
+
   virtual void visit(EventVisitor* visitor) const = 0;
 
   template <typename T>
@@ -85,6 +97,10 @@ struct Event
 
   // JSON representation for an Event.
   operator JSON::Object() const;
+
+  // When the event was enqueued, only recorded if process statistics
+  // are enabled (see `LIBPROCESS_ENABLE_PROCESS_STATISTICS`).
+  std::chrono::steady_clock::time_point enqueued;
 };
 
 
@@ -164,10 +180,10 @@ struct DispatchEvent : Event
 {
   DispatchEvent(
       const UPID& _pid,
-      const std::shared_ptr<lambda::function<void(ProcessBase*)>>& _f,
+      lambda::function<void(ProcessBase*)>&& _f,
       const Option<const std::type_info*>& _functionType)
     : pid(_pid),
-      f(_f),
+      f(std::move(_f)),
       functionType(_functionType)
   {}
 
@@ -180,7 +196,7 @@ struct DispatchEvent : Event
   const UPID pid;
 
   // Function to get invoked as a result of this dispatch event.
-  const std::shared_ptr<lambda::function<void(ProcessBase*)>> f;
+  const lambda::function<void(ProcessBase*)> f;
 
   const Option<const std::type_info*> functionType;
 
@@ -248,7 +264,7 @@ inline Event::operator JSON::Object() const
       object->values["name"] = message.name;
       object->values["from"] = stringify(message.from);
       object->values["to"] = stringify(message.to);
-      object->values["body"] = message.body;
+      object->values["body"] = message.body.get();
     }
 
     virtual void visit(const HttpEvent& event)
@@ -43,6 +43,7 @@
 #include <stout/result_of.hpp>
 #include <stout/synchronized.hpp>
 #include <stout/try.hpp>
+#include <stout/unreachable.hpp>
 
 #include <stout/os/strerror.hpp>
 
@@ -220,10 +221,10 @@ private:
   template <typename F, typename = typename result_of<F(const T&)>::type>
   const Future<T>& onReady(F&& f, Prefer) const
   {
-    return onReady(std::function<void(const T&)>(
+    return install<ON_READY>(
         [=](const T& t) mutable {
           f(t);
-        }));
+        });
   }
 
   // This is the less preferred `onReady`, we prefer the `onReady` method which
@@ -241,19 +242,19 @@ private:
           F>::type()>::type>
   const Future<T>& onReady(F&& f, LessPrefer) const
   {
-    return onReady(std::function<void(const T&)>(
+    return install<ON_READY>(
         [=](const T&) mutable {
           f();
-        }));
+        });
   }
 
   template <typename F, typename = typename result_of<F(const std::string&)>::type> // NOLINT(whitespace/line_length)
   const Future<T>& onFailed(F&& f, Prefer) const
   {
-    return onFailed(std::function<void(const std::string&)>(
+    return install<ON_FAILED>(
         [=](const std::string& message) mutable {
           f(message);
-        }));
+        });
   }
 
   // Refer to the less preferred version of `onReady` for why these SFINAE
@@ -265,19 +266,19 @@ private:
           F>::type()>::type>
   const Future<T>& onFailed(F&& f, LessPrefer) const
   {
-    return onFailed(std::function<void(const std::string&)>(
+    return install<ON_FAILED>(
         [=](const std::string&) mutable {
           f();
-        }));
+        });
   }
 
   template <typename F, typename = typename result_of<F(const Future<T>&)>::type> // NOLINT(whitespace/line_length)
   const Future<T>& onAny(F&& f, Prefer) const
   {
-    return onAny(std::function<void(const Future<T>&)>(
+    return install<ON_ANY>(
         [=](const Future<T>& future) mutable {
           f(future);
-        }));
+        });
   }
 
   // Refer to the less preferred version of `onReady` for why these SFINAE
@@ -289,20 +290,20 @@ private:
           F>::type()>::type>
   const Future<T>& onAny(F&& f, LessPrefer) const
   {
-    return onAny(std::function<void(const Future<T>&)>(
+    return install<ON_ANY>(
         [=](const Future<T>&) mutable {
           f();
-        }));
+        });
   }
 
 public:
   template <typename F>
   const Future<T>& onDiscard(F&& f) const
   {
-    return onDiscard(std::function<void()>(
+    return install<ON_DISCARD>(
         [=]() mutable {
           f();
-        }));
+        });
   }
 
   template <typename F>
@@ -320,10 +321,10 @@ public:
   template <typename F>
   const Future<T>& onDiscarded(F&& f) const
   {
-    return onDiscarded(std::function<void()>(
+    return install<ON_DISCARDED>(
         [=]() mutable {
           f();
-        }));
+        });
   }
 
   template <typename F>
@@ -452,10 +453,101 @@ private:
     DISCARDED,
   };
 
+  // The events that a callback can be installed for.
+  enum Trigger
+  {
+    ON_DISCARD,
+    ON_READY,
+    ON_FAILED,
+    ON_DISCARDED,
+    ON_ANY,
+  };
+
+  // An installed callback. The callbacks of a future are kept in a
+  // single intrusive list (in the order they were installed) rather
+  // than one vector per event, and each callback stores its callable
+  // inline, so installing a callback costs a single allocation.
+  struct Callback
+  {
+    explicit Callback(Trigger _trigger) : trigger(_trigger), next(nullptr) {}
+    virtual ~Callback() {}
+
+    virtual void operator()(const Future<T>& future) = 0;
+
+    const Trigger trigger;
+    Callback* next;
+  };
+
+  template <Trigger trigger, typename F>
+  struct CallbackImpl : Callback
+  {
+    template <typename G>
+    explicit CallbackImpl(G&& g) : Callback(trigger), f(std::forward<G>(g)) {}
+
+    void operator()(const Future<T>& future) override
+    {
+      invoke(future, std::integral_constant<Trigger, trigger>());
+    }
+
+    void invoke(const Future<T>&, std::integral_constant<Trigger, ON_DISCARD>)
+    {
+      f();
+    }
+
+    void invoke(const Future<T>& future,
+                std::integral_constant<Trigger, ON_READY>)
+    {
+      f(future.data->result.get());
+    }
+
+    void invoke(const Future<T>& future,
+                std::integral_constant<Trigger, ON_FAILED>)
+    {
+      f(future.data->result.error());
+    }
+
+    void invoke(const Future<T>&,
+                std::integral_constant<Trigger, ON_DISCARDED>)
+    {
+      f();
+    }
+
+    void invoke(const Future<T>& future,
+                std::integral_constant<Trigger, ON_ANY>)
+    {
+      f(future);
+    }
+
+    F f;
+  };
+
+  template <Trigger trigger, typename F>
+  static Callback* callback(F&& f)
+  {
+    return new CallbackImpl<trigger, typename std::decay<F>::type>(
+        std::forward<F>(f));
+  }
+
+  // Installs the callback, or invokes it right away if the future has
+  // already transitioned to the state that triggers it.
+  template <Trigger trigger, typename F>
+  const Future<T>& install(F&& f) const;
+
   struct Data
   {
     Data();
-    ~Data() = default;
+    ~Data();
+
+    // Returns true if the callbacks for the trigger have already been
+    // invoked (or are being invoked), i.e., a callback for the trigger
+    // that gets installed now should be invoked right away.
+    bool triggered(Trigger trigger) const;
+
+    void append(Callback* callback);
+
+    // Invokes all the callbacks for the trigger, in the order they
+    // were installed.
+    void run(Trigger trigger, const Future<T>& future);
 
     void clearAllCallbacks();
 
@@ -470,11 +562,8 @@ private:
     //   3. Error, the state is FAILED; 'error()' stores the message.
     Result<T> result;
 
-    std::vector<DiscardCallback> onDiscardCallbacks;
-    std::vector<ReadyCallback> onReadyCallbacks;
-    std::vector<FailedCallback> onFailedCallbacks;
-    std::vector<DiscardedCallback> onDiscardedCallbacks;
-    std::vector<AnyCallback> onAnyCallbacks;
+    Callback* head;
+    Callback* tail;
   };
 
   // Sets the value for this future, unless the future is already set,
@@ -493,22 +582,6 @@ private:
 };
 
 
-namespace internal {
-
-// Helper for executing callbacks that have been registered.
-//
-// TODO(*): Invoke callbacks in another execution context.
-template <typename C, typename... Arguments>
-void run(const std::vector<C>& callbacks, Arguments&&... arguments)
-{
-  for (size_t i = 0; i < callbacks.size(); ++i) {
-    callbacks[i](std::forward<Arguments>(arguments)...);
-  }
-}
-
-} // namespace internal {
-
-
 // Represents a weak reference to a future. This class is used to
 // break cyclic dependencies between futures.
 template <typename T>
@@ -898,8 +971,8 @@ bool Promise<T>::discard(Future<T> future)
     // ourselves from one of the callbacks erroneously deleting the
     // future. In `Future::_set()` and `Future::fail()` we have to
     // explicitly take a copy to protect ourselves.
-    internal::run(future.data->onDiscardedCallbacks);
-    internal::run(future.data->onAnyCallbacks, future);
+    future.data->run(Future<T>::ON_DISCARDED, future);
+    future.data->run(Future<T>::ON_ANY, future);
 
     future.data->clearAllCallbacks();
   }
@@ -922,37 +995,91 @@ Future<T>::Data::Data()
   : state(PENDING),
     discard(false),
     associated(false),
-    result(None()) {}
+    result(None()),
+    head(nullptr),
+    tail(nullptr) {}
+
+
+template <typename T>
+Future<T>::Data::~Data()
+{
+  clearAllCallbacks();
+}
+
+
+template <typename T>
+bool Future<T>::Data::triggered(Trigger trigger) const
+{
+  switch (trigger) {
+    case ON_DISCARD: return discard;
+    case ON_READY: return state == READY;
+    case ON_FAILED: return state == FAILED;
+    case ON_DISCARDED: return state == DISCARDED;
+    case ON_ANY: return state != PENDING;
+  }
+
+  UNREACHABLE();
+}
+
+
+template <typename T>
+void Future<T>::Data::append(Callback* callback)
+{
+  if (tail == nullptr) {
+    head = tail = callback;
+  } else {
+    tail = tail->next = callback;
+  }
+}
+
+
+template <typename T>
+void Future<T>::Data::run(Trigger trigger, const Future<T>& future)
+{
+  // TODO(*): Invoke callbacks in another execution context.
+  for (Callback* callback = head; callback != nullptr;
+       callback = callback->next) {
+    if (callback->trigger == trigger) {
+      (*callback)(future);
+    }
+  }
+}
 
 
 template <typename T>
 void Future<T>::Data::clearAllCallbacks()
 {
-  onAnyCallbacks.clear();
-  onDiscardCallbacks.clear();
-  onDiscardedCallbacks.clear();
-  onFailedCallbacks.clear();
-  onReadyCallbacks.clear();
+  while (head != nullptr) {
+    Callback* callback = head;
+    head = head->next;
+    delete callback;
+  }
+
+  tail = nullptr;
 }
 
 
 template <typename T>
 Future<T>::Future()
-  : data(new Data()) {}
+  : data(std::make_shared<Data>()) {}
 
 
 template <typename T>
 Future<T>::Future(const T& _t)
-  : data(new Data())
+  : data(std::make_shared<Data>())
 {
-  set(_t);
+  // Nobody else can have a reference to a future that is still being
+  // constructed, so there are no callbacks to invoke and we can skip
+  // the synchronization done by `set`.
+  data->result = _t;
+  data->state = READY;
 }
 
 
 template <typename T>
 template <typename U>
 Future<T>::Future(const U& u)
-  : data(new Data())
+  : data(std::make_shared<Data>())
 {
   set(u);
 }
@@ -960,17 +1087,21 @@ Future<T>::Future(const U& u)
 
 template <typename T>
 Future<T>::Future(const Failure& failure)
-  : data(new Data())
+  : data(std::make_shared<Data>())
 {
-  fail(failure.message);
+  // See the comment in `Future(const T&)`.
+  data->result = Result<T>(Error(failure.message));
+  data->state = FAILED;
 }
 
 
 template <typename T>
 Future<T>::Future(const ErrnoFailure& failure)
-  : data(new Data())
+  : data(std::make_shared<Data>())
 {
-  fail(failure.message);
+  // See the comment in `Future(const T&)`.
+  data->result = Result<T>(Error(failure.message));
+  data->state = FAILED;
 }
 
 
@@ -986,7 +1117,7 @@ Future<T>::Future(Future<T>&& that)
 
 template <typename T>
 Future<T>::Future(const Try<T>& t)
-  : data(new Data())
+  : data(std::make_shared<Data>())
 {
   if (t.isSome()){
     set(t.get());
@@ -1032,20 +1163,46 @@ bool Future<T>::discard()
 {
   bool result = false;
 
-  std::vector<DiscardCallback> callbacks;
+  // The discard callbacks, unlinked from the list of callbacks.
+  Callback* head = nullptr;
+  Callback** tail = &head;
+
   synchronized (data->lock) {
     if (!data->discard && data->state == PENDING) {
       result = data->discard = true;
 
-      callbacks.swap(data->onDiscardCallbacks);
+      Callback* previous = nullptr;
+      Callback* callback = data->head;
+      while (callback != nullptr) {
+        Callback* next = callback->next;
+
+        if (callback->trigger == ON_DISCARD) {
+          if (previous == nullptr) {
+            data->head = next;
+          } else {
+            previous->next = next;
+          }
+
+          callback->next = nullptr;
+          *tail = callback;
+          tail = &callback->next;
+        } else {
+          previous = callback;
+        }
+
+        callback = next;
+      }
+
+      data->tail = previous;
     }
   }
 
   // Invoke all callbacks associated with doing a discard on this
-  // future. The callbacks get destroyed when we exit from the
-  // function.
-  if (result) {
-    internal::run(callbacks);
+  // future. The callbacks get destroyed as they are invoked.
+  while (head != nullptr) {
+    std::unique_ptr<Callback> callback(head);
+    head = head->next;
+    (*callback)(*this);
   }
 
   return result;
@@ -1119,7 +1276,8 @@ bool Future<T>::await(const Duration& duration) const
   synchronized (data->lock) {
     if (data->state == PENDING) {
       pending = true;
-      data->onAnyCallbacks.push_back(lambda::bind(&internal::awaited, latch));
+      data->append(
+          callback<ON_ANY>(lambda::bind(&internal::awaited, latch)));
     }
   }
 
@@ -1170,21 +1328,25 @@ const std::string& Future<T>::failure() const
 
 
 template <typename T>
-const Future<T>& Future<T>::onDiscard(DiscardCallback&& callback) const
+template <typename Future<T>::Trigger trigger, typename F>
+const Future<T>& Future<T>::install(F&& f) const
 {
   bool run = false;
 
   synchronized (data->lock) {
-    if (data->discard) {
+    if (data->triggered(trigger)) {
       run = true;
     } else if (data->state == PENDING) {
-      data->onDiscardCallbacks.emplace_back(std::move(callback));
+      data->append(callback<trigger>(std::forward<F>(f)));
     }
   }
 
+  // A callback that is invoked right away is never allocated.
+  //
   // TODO(*): Invoke callback in another execution context.
   if (run) {
-    callback();
+    CallbackImpl<trigger, typename std::decay<F>::type>(
+        std::forward<F>(f))(*this);
   }
 
   return *this;
@@ -1192,90 +1354,37 @@ const Future<T>& Future<T>::onDiscard(DiscardCallback&& callback) const
 
 
 template <typename T>
-const Future<T>& Future<T>::onReady(ReadyCallback&& callback) const
+const Future<T>& Future<T>::onDiscard(DiscardCallback&& callback) const
 {
-  bool run = false;
+  return install<ON_DISCARD>(std::move(callback));
+}
 
-  synchronized (data->lock) {
-    if (data->state == READY) {
-      run = true;
-    } else if (data->state == PENDING) {
-      data->onReadyCallbacks.emplace_back(std::move(callback));
-    }
-  }
 
-  // TODO(*): Invoke callback in another execution context.
-  if (run) {
-    callback(data->result.get());
-  }
-
-  return *this;
+template <typename T>
+const Future<T>& Future<T>::onReady(ReadyCallback&& callback) const
+{
+  return install<ON_READY>(std::move(callback));
 }
 
 
 template <typename T>
 const Future<T>& Future<T>::onFailed(FailedCallback&& callback) const
 {
-  bool run = false;
-
-  synchronized (data->lock) {
-    if (data->state == FAILED) {
-      run = true;
-    } else if (data->state == PENDING) {
-      data->onFailedCallbacks.emplace_back(std::move(callback));
-    }
-  }
-
-  // TODO(*): Invoke callback in another execution context.
-  if (run) {
-    callback(data->result.error());
-  }
-
-  return *this;
+  return install<ON_FAILED>(std::move(callback));
 }
 
 
 template <typename T>
 const Future<T>& Future<T>::onDiscarded(DiscardedCallback&& callback) const
 {
-  bool run = false;
-
-  synchronized (data->lock) {
-    if (data->state == DISCARDED) {
-      run = true;
-    } else if (data->state == PENDING) {
-      data->onDiscardedCallbacks.emplace_back(std::move(callback));
-    }
-  }
-
-  // TODO(*): Invoke callback in another execution context.
-  if (run) {
-    callback();
-  }
-
-  return *this;
+  return install<ON_DISCARDED>(std::move(callback));
 }
 
 
 template <typename T>
 const Future<T>& Future<T>::onAny(AnyCallback&& callback) const
 {
-  bool run = false;
-
-  synchronized (data->lock) {
-    if (data->state == PENDING) {
-      data->onAnyCallbacks.emplace_back(std::move(callback));
-    } else {
-      run = true;
-    }
-  }
-
-  // TODO(*): Invoke callback in another execution context.
-  if (run) {
-    callback(*this);
-  }
-
-  return *this;
+  return install<ON_ANY>(std::move(callback));
 }
 
 namespace internal {
@@ -1396,10 +1505,8 @@ Future<X> Future<T>::then(lambda::function<Future<X>(const T&)> f) const
 {
   std::shared_ptr<Promise<X>> promise(new Promise<X>());
 
-  lambda::function<void(const Future<T>&)> thenf =
-    lambda::bind(&internal::thenf<T, X>, std::move(f), promise, lambda::_1);
-
-  onAny(std::move(thenf));
+  onAny(
+      lambda::bind(&internal::thenf<T, X>, std::move(f), promise, lambda::_1));
 
   // Propagate discarding up the chain. To avoid cyclic dependencies,
   // we keep a weak future in the callback.
@@ -1416,10 +1523,8 @@ Future<X> Future<T>::then(lambda::function<X(const T&)> f) const
 {
   std::shared_ptr<Promise<X>> promise(new Promise<X>());
 
-  lambda::function<void(const Future<T>&)> then =
-    lambda::bind(&internal::then<T, X>, std::move(f), promise, lambda::_1);
-
-  onAny(std::move(then));
+  onAny(
+      lambda::bind(&internal::then<T, X>, std::move(f), promise, lambda::_1));
 
   // Propagate discarding up the chain. To avoid cyclic dependencies,
   // we keep a weak future in the callback.
@@ -1533,8 +1638,8 @@ bool Future<T>::_set(U&& u)
     // Grab a copy of `data` just in case invoking the callbacks
     // erroneously attempts to delete this future.
     std::shared_ptr<typename Future<T>::Data> copy = data;
-    internal::run(copy->onReadyCallbacks, copy->result.get());
-    internal::run(copy->onAnyCallbacks, *this);
+    copy->run(ON_READY, *this);
+    copy->run(ON_ANY, *this);
 
     copy->clearAllCallbacks();
   }
@@ -1563,8 +1668,8 @@ bool Future<T>::fail(const std::string& _message)
     // Grab a copy of `data` just in case invoking the callbacks
     // erroneously attempts to delete this future.
     std::shared_ptr<typename Future<T>::Data> copy = data;
-    internal::run(copy->onFailedCallbacks, copy->result.error());
-    internal::run(copy->onAnyCallbacks, *this);
+    copy->run(ON_FAILED, *this);
+    copy->run(ON_ANY, *this);
 
     copy->clearAllCallbacks();
   }
@@ -0,0 +1,146 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#ifndef __PROCESS_HISTOGRAM_HPP__
+#define __PROCESS_HISTOGRAM_HPP__
+
+#include <stddef.h> // For size_t.
+#include <stdint.h>
+
+#include <vector>
+
+#include <process/clock.hpp>
+#include <process/time.hpp>
+
+#include <stout/duration.hpp>
+#include <stout/option.hpp>
+
+namespace process {
+
+// A histogram for computing approximate quantiles of a stream of
+// values in bounded memory, see "DDSketch: A Fast and Fully-Mergeable
+// Quantile Sketch with Relative-Error Guarantees" (VLDB 2019).
+//
+// Values are counted in buckets whose bounds grow geometrically, so
+// that every value in a bucket is within `ACCURACY` (relative) of the
+// value the bucket represents. Unlike a `TimeSeries`, no value is
+// ever dropped and a quantile is computed in O(BUCKETS) without
+// copying or sorting. The memory is bounded by `BUCKETS` counters for
+// the positive and the negative values each: once the magnitudes of
+// the values span more than that (about 9 orders of magnitude), the
+// buckets of the smallest magnitudes get collapsed, which only
+// affects the accuracy of the lowest quantiles.
+//
+// Histograms can be merged, e.g., to combine the histograms of
+// consecutive intervals (see `RollingHistogram`).
+class Histogram
+{
+public:
+  static const double ACCURACY;
+  static const size_t BUCKETS;
+
+  Histogram();
+
+  // Counts the value. NaN values are ignored.
+  void add(double value);
+
+  // Counts all the values counted by the other histogram.
+  void merge(const Histogram& that);
+
+  uint64_t count() const { return total; }
+
+  // The exact minimum and maximum of the values, if any.
+  Option<double> min() const;
+  Option<double> max() const;
+
+  // Returns the value at the quantile `q` in [0, 1], using linear
+  // interpolation between the closest ranks (like `Statistics`), or
+  // none if there are no values.
+  Option<double> quantile(double q) const;
+
+private:
+  // The buckets for the values of one sign, keyed by the logarithm of
+  // the magnitude. Only a window of `BUCKETS` consecutive keys is kept
+  // (allocated with the first value).
+  class Store
+  {
+  public:
+    Store() : offset(0), lowest(0), highest(0), total(0) {}
+
+    void add(int key, uint64_t count);
+    void merge(const Store& that);
+
+    uint64_t count() const { return total; }
+
+    // Returns the key of the bucket of the value with the specified
+    // rank, counting from the lowest key.
+    int key(uint64_t rank) const;
+
+  private:
+    // Moves the window so that it includes the key, collapsing the
+    // lowest buckets if need be. Returns the key to count in.
+    int extend(int key);
+
+    std::vector<uint64_t> counts;
+    int offset; // The key of `counts[0]`.
+    int lowest; // The lowest key with a non-zero count.
+    int highest; // The highest key with a non-zero count.
+    uint64_t total;
+  };
+
+  static int key(double magnitude);
+  static double value(int key);
+
+  // Returns the value with the specified rank, counting from the
+  // lowest value.
+  double rank(uint64_t rank) const;
+
+  Store positive;
+  Store negative; // Keyed by the magnitude.
+  uint64_t zeros;
+
+  uint64_t total;
+  double minimum;
+  double maximum;
+};
+
+
+// A histogram of the values of (roughly) the last `window`. It keeps
+// one histogram for each of `intervals` consecutive intervals of the
+// window and merges the ones that are still within the window when
+// they are queried, so values expire one interval at a time.
+class RollingHistogram
+{
+public:
+  explicit RollingHistogram(const Duration& window, size_t intervals = 4);
+
+  void add(double value, const Time& time = Clock::now());
+
+  // Returns the histogram of the values that were added within the
+  // window ending at the specified time.
+  Histogram get(const Time& time = Clock::now()) const;
+
+private:
+  int64_t interval(const Time& time) const;
+
+  const Duration duration; // The duration of an interval.
+
+  std::vector<Histogram> histograms;
+
+  // The intervals the histograms are for, see `interval`.
+  std::vector<Option<int64_t>> indices;
+};
+
+} // namespace process {
+
+#endif // __PROCESS_HISTOGRAM_HPP__
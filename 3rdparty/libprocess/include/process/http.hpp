@@ -32,6 +32,7 @@
 #include <process/pid.hpp>
 #include <process/socket.hpp>
 
+#include <stout/duration.hpp>
 #include <stout/error.hpp>
 #include <stout/hashmap.hpp>
 #include <stout/ip.hpp>
@@ -655,6 +656,13 @@ struct Response
   std::string path;
   Option<Pipe::Reader> reader;
 
+  // Whether to compress a PIPE response for clients that accept it.
+  // Every chunk gets flushed so that the client can decompress it
+  // right away, which does not pay off for streams of small chunks
+  // (e.g., events), hence this is opt-in. BODY responses are instead
+  // compressed based on their size.
+  bool compress = false;
+
   uint16_t code;
 };
 
@@ -986,6 +994,75 @@ Future<Connection> connect(const network::Address& address, Scheme scheme);
 Future<Connection> connect(const URL& url);
 
 
+namespace internal {
+
+// Forward declaration.
+class ConnectionPoolProcess;
+
+} // namespace internal {
+
+
+/**
+ * A pool of persistent connections for sending requests to any number
+ * of servers, keyed by the scheme, host and port of the request URL.
+ * A request is sent on an existing connection to the server if one
+ * can take it, otherwise a new connection is opened for it (up to
+ * `maxConnections` per server, beyond which requests wait for a
+ * connection to become available). Connections that have been idle
+ * for `idleTimeout` get closed.
+ *
+ * The pool exposes the following metrics, where `<name>` is the name
+ * of the pool (which should thus be unique):
+ *
+ *   libprocess/http/connection_pools/<name>/hits
+ *     Requests sent on a connection that was already used before.
+ *   libprocess/http/connection_pools/<name>/misses
+ *     Requests sent on a connection that was opened for them.
+ *   libprocess/http/connection_pools/<name>/connections
+ *     Open connections.
+ */
+class ConnectionPool
+{
+public:
+  struct Options
+  {
+    Options()
+      : idleTimeout(Seconds(30)),
+        maxConnections(8),
+        maxPipelinedRequests(1) {}
+
+    Duration idleTimeout;
+
+    // The maximum number of connections to each server.
+    size_t maxConnections;
+
+    // The maximum number of requests in flight on each connection.
+    // Pipelining more than one request means a slow response holds
+    // back the responses after it, hence it is disabled by default.
+    size_t maxPipelinedRequests;
+  };
+
+  explicit ConnectionPool(
+      const std::string& name,
+      const Options& options = Options());
+
+  /**
+   * Sends the request on a pooled connection, the request is always
+   * sent with 'Connection: keep-alive'. A request that wants a
+   * streamed response is sent on a connection of its own, which is
+   * closed after the response (the pool cannot tell when the caller
+   * is done reading the body).
+   */
+  Future<Response> send(const Request& request, bool streamedResponse = false);
+
+private:
+  // Forward declaration.
+  struct Data;
+
+  std::shared_ptr<Data> data;
+};
+
+
 namespace internal {
 
 Future<Nothing> serve(
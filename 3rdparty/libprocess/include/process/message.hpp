@@ -15,6 +15,7 @@
 
 #include <string>
 
+#include <process/buffer.hpp>
 #include <process/pid.hpp>
 
 namespace process {
@@ -24,7 +25,10 @@ struct Message
   std::string name;
   UPID from;
   UPID to;
-  std::string body;
+
+  // NOTE: The body is reference counted, so copying a message doesn't
+  // copy its body.
+  Buffer body;
 };
 
 } // namespace process {
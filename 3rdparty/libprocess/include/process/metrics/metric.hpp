@@ -18,9 +18,9 @@
 #include <string>
 
 #include <process/future.hpp>
+#include <process/histogram.hpp>
 #include <process/owned.hpp>
 #include <process/statistics.hpp>
-#include <process/timeseries.hpp>
 
 #include <stout/duration.hpp>
 #include <stout/option.hpp>
@@ -41,13 +41,13 @@ public:
     return data->name;
   }
 
-  Option<Statistics<double>> statistics() const
+  virtual Option<Statistics<double>> statistics() const
   {
     Option<Statistics<double>> statistics = None();
 
     if (data->history.isSome()) {
       synchronized (data->lock) {
-        statistics = Statistics<double>::from(*data->history.get());
+        statistics = Statistics<double>::from(data->history.get()->get());
       }
     }
 
@@ -65,7 +65,7 @@ protected:
       Time now = Clock::now();
 
       synchronized (data->lock) {
-        data->history.get()->set(value, now);
+        data->history.get()->add(value, now);
       }
     }
   }
@@ -78,7 +78,7 @@ private:
     {
       if (window.isSome()) {
         history =
-          Owned<TimeSeries<double>>(new TimeSeries<double>(window.get()));
+          Owned<RollingHistogram>(new RollingHistogram(window.get()));
       }
     }
 
@@ -86,7 +86,9 @@ private:
 
     std::atomic_flag lock = ATOMIC_FLAG_INIT;
 
-    Option<Owned<TimeSeries<double>>> history;
+    // The values of (roughly) the last window, for computing the
+    // statistics of the metric in constant memory.
+    Option<Owned<RollingHistogram>> history;
   };
 
   std::shared_ptr<Data> data;
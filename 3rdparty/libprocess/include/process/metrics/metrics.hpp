@@ -23,9 +23,11 @@
 
 #include <process/metrics/metric.hpp>
 
+#include <stout/duration.hpp>
 #include <stout/hashmap.hpp>
 #include <stout/nothing.hpp>
 #include <stout/option.hpp>
+#include <stout/try.hpp>
 
 namespace process {
 namespace metrics {
@@ -48,12 +50,15 @@ protected:
 
 private:
   static std::string help();
+  static std::string prometheusHelp();
 
   MetricsProcess(
       const Option<Owned<RateLimiter>>& _limiter,
+      const Option<Duration>& _interval,
       const Option<std::string>& _authenticationRealm)
     : ProcessBase("metrics"),
       limiter(_limiter),
+      interval(_interval),
       authenticationRealm(_authenticationRealm)
   {}
 
@@ -61,10 +66,35 @@ private:
   MetricsProcess(const MetricsProcess&);
   MetricsProcess& operator=(const MetricsProcess&);
 
+  // A sample of all the metrics, prerendered for the endpoints.
+  struct Sample
+  {
+    explicit Sample(const hashmap<std::string, double>& values);
+
+    std::string json;
+    std::string prometheus;
+  };
+
   Future<http::Response> _snapshot(
       const http::Request& request,
       const Option<http::authentication::Principal>&);
 
+  Future<http::Response> prometheus(
+      const http::Request& request,
+      const Option<http::authentication::Principal>&);
+
+  // Parses the optional 'timeout' query parameter of the endpoints.
+  static Try<Option<Duration>> timeout(const http::Request& request);
+
+  // Takes a snapshot for one of the endpoints, subject to the rate
+  // limit.
+  Future<hashmap<std::string, double>> limitedSnapshot(
+      const Option<Duration>& timeout);
+
+  // Takes a sample of all metrics, see `interval`.
+  void sample();
+  void _sample(const Future<hashmap<std::string, double>>& snapshot);
+
   static std::list<Future<double>> _snapshotTimeout(
       const std::list<Future<double>>& futures);
 
@@ -79,6 +109,14 @@ private:
   // Used to rate limit the snapshot endpoint.
   Option<Owned<RateLimiter>> limiter;
 
+  // If set, the metrics are sampled in the background at this interval
+  // and the endpoints serve the last sample right away, instead of
+  // collecting all the metrics for every request.
+  const Option<Duration> interval;
+
+  // The last sample, if sampling is enabled.
+  Option<Sample> last;
+
   // The authentication realm that metrics HTTP endpoints are installed into.
   const Option<std::string> authenticationRealm;
 };
@@ -0,0 +1,100 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#ifndef __PROCESS_METRICS_PUSH_GAUGE_HPP__
+#define __PROCESS_METRICS_PUSH_GAUGE_HPP__
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <process/metrics/metric.hpp>
+
+#include <stout/duration.hpp>
+#include <stout/option.hpp>
+
+namespace process {
+namespace metrics {
+
+// A Metric that represents an instantaneous value that is pushed by
+// its owner whenever it changes, rather than being evaluated (often
+// by dispatching to the owner, see `Gauge`) when 'value' is called.
+// Reading a PushGauge never blocks, which makes it the preferred kind
+// of gauge for processes that might be busy when the metrics are
+// collected.
+class PushGauge : public Metric
+{
+public:
+  // 'name' is the unique name for the instance of PushGauge being
+  // constructed. It will be the key exposed in the JSON endpoint.
+  // 'window' is the amount of history to keep for this Metric, every
+  // value that is pushed becomes part of the statistics.
+  explicit PushGauge(
+      const std::string& name,
+      const Option<Duration>& window = None())
+    : Metric(name, window),
+      data(new Data()) {}
+
+  virtual ~PushGauge() {}
+
+  virtual Future<double> value() const
+  {
+    return static_cast<double>(data->value.load());
+  }
+
+  PushGauge& operator=(int64_t v)
+  {
+    data->value.store(v);
+    push(static_cast<double>(v));
+    return *this;
+  }
+
+  PushGauge& operator++()
+  {
+    return *this += 1;
+  }
+
+  PushGauge& operator+=(int64_t v)
+  {
+    int64_t prev = data->value.fetch_add(v);
+    push(static_cast<double>(prev + v));
+    return *this;
+  }
+
+  PushGauge& operator--()
+  {
+    return *this -= 1;
+  }
+
+  PushGauge& operator-=(int64_t v)
+  {
+    int64_t prev = data->value.fetch_sub(v);
+    push(static_cast<double>(prev - v));
+    return *this;
+  }
+
+private:
+  struct Data
+  {
+    explicit Data() : value(0) {}
+
+    std::atomic<int64_t> value;
+  };
+
+  std::shared_ptr<Data> data;
+};
+
+} // namespace metrics {
+} // namespace process {
+
+#endif // __PROCESS_METRICS_PUSH_GAUGE_HPP__
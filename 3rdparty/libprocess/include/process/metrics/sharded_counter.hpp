@@ -0,0 +1,95 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#ifndef __PROCESS_METRICS_SHARDED_COUNTER_HPP__
+#define __PROCESS_METRICS_SHARDED_COUNTER_HPP__
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <process/metrics/metric.hpp>
+#include <process/metrics/shards.hpp>
+
+namespace process {
+namespace metrics {
+
+// A Counter for values that are updated from many threads at once.
+// Rather than all threads updating a single atomic, each thread adds
+// to a shard of its own that is summed up when the value is read, so
+// updating the counter does not bounce a cache line between cores.
+// Reading the counter is correspondingly more expensive.
+//
+// NOTE: A ShardedCounter does not keep any history, i.e., it has no
+// statistics.
+class ShardedCounter : public Metric
+{
+public:
+  // 'name' is the unique name for the instance of ShardedCounter being
+  // constructed. This is what will be used as the key in the JSON
+  // endpoint.
+  explicit ShardedCounter(const std::string& name)
+    : Metric(name, None()),
+      data(new Data()) {}
+
+  virtual ~ShardedCounter() {}
+
+  virtual Future<double> value() const
+  {
+    int64_t value = 0;
+    for (size_t i = 0; i < data->shards.size(); i++) {
+      value += data->shards[i].load(std::memory_order_relaxed);
+    }
+
+    return static_cast<double>(value);
+  }
+
+  // NOTE: Increments that race with a reset might be kept.
+  void reset()
+  {
+    for (size_t i = 0; i < data->shards.size(); i++) {
+      data->shards[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  ShardedCounter& operator++()
+  {
+    return *this += 1;
+  }
+
+  ShardedCounter operator++(int)
+  {
+    ShardedCounter c(*this);
+    ++(*this);
+    return c;
+  }
+
+  ShardedCounter& operator+=(int64_t v)
+  {
+    data->shards.local().fetch_add(v, std::memory_order_relaxed);
+    return *this;
+  }
+
+private:
+  struct Data
+  {
+    internal::Shards<std::atomic<int64_t>> shards;
+  };
+
+  std::shared_ptr<Data> data;
+};
+
+} // namespace metrics {
+} // namespace process {
+
+#endif // __PROCESS_METRICS_SHARDED_COUNTER_HPP__
@@ -0,0 +1,183 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#ifndef __PROCESS_METRICS_SHARDED_TIMER_HPP__
+#define __PROCESS_METRICS_SHARDED_TIMER_HPP__
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include <process/clock.hpp>
+#include <process/future.hpp>
+#include <process/histogram.hpp>
+#include <process/owned.hpp>
+
+#include <process/metrics/metric.hpp>
+#include <process/metrics/shards.hpp>
+
+#include <stout/duration.hpp>
+#include <stout/option.hpp>
+#include <stout/synchronized.hpp>
+
+namespace process {
+namespace metrics {
+
+// A Timer for events that are timed from many threads at once. Each
+// thread records into a shard of its own (see ShardedCounter), and
+// the history of the shards is merged when the statistics are read.
+//
+// NOTE: Unlike for Timer, 'start' returns the start of the timing
+// which has to be passed to 'stop', so that concurrent timings do not
+// interfere with each other and an actor can stop a timing on another
+// thread than the one it was started on.
+template <class T>
+class ShardedTimer : public Metric
+{
+public:
+  // The ShardedTimer name will have a unit suffix added automatically.
+  ShardedTimer(
+      const std::string& name,
+      const Option<Duration>& window = None())
+    : Metric(name + "_" + T::units(), None()),
+      data(new Data(window)) {}
+
+  // Returns the last value recorded by any thread.
+  Future<double> value() const
+  {
+    Option<Time> last;
+    double value = 0.0;
+
+    for (size_t i = 0; i < data->shards.size(); i++) {
+      Shard& shard = data->shards[i];
+
+      synchronized (shard.lock) {
+        if (shard.last.isSome() &&
+            (last.isNone() || shard.last.get() > last.get())) {
+          last = shard.last;
+          value = shard.lastValue;
+        }
+      }
+    }
+
+    if (last.isNone()) {
+      return Failure("No value");
+    }
+
+    return value;
+  }
+
+  virtual Option<Statistics<double>> statistics() const
+  {
+    if (data->window.isNone()) {
+      return None();
+    }
+
+    const Time now = Clock::now();
+
+    Histogram histogram;
+
+    for (size_t i = 0; i < data->shards.size(); i++) {
+      Shard& shard = data->shards[i];
+
+      synchronized (shard.lock) {
+        if (shard.history.isSome()) {
+          histogram.merge(shard.history.get()->get(now));
+        }
+      }
+    }
+
+    return Statistics<double>::from(histogram);
+  }
+
+  // Starts a timing, returns its start to be passed to 'stop'.
+  Time start() const
+  {
+    return Clock::now();
+  }
+
+  // Stops the timing that was started at 'start' and records it.
+  T stop(const Time& start)
+  {
+    const Time stop = Clock::now();
+
+    const T t(stop - start);
+
+    record(t.value(), stop);
+
+    return t;
+  }
+
+  // Time an asynchronous event.
+  template <typename U>
+  Future<U> time(const Future<U>& future)
+  {
+    // We need to take a copy of 'this' here to ensure that the
+    // ShardedTimer is not destroyed in the interim.
+    future
+      .onAny(lambda::bind(_time, Clock::now(), *this));
+
+    return future;
+  }
+
+private:
+  struct Shard
+  {
+    std::atomic_flag lock = ATOMIC_FLAG_INIT;
+    Option<Time> last;
+    double lastValue = 0.0;
+    Option<Owned<RollingHistogram>> history;
+  };
+
+  struct Data
+  {
+    explicit Data(const Option<Duration>& _window) : window(_window) {}
+
+    const Option<Duration> window;
+
+    internal::Shards<Shard> shards;
+  };
+
+  static void _time(Time start, ShardedTimer that)
+  {
+    const Time stop = Clock::now();
+
+    that.record(T(stop - start).value(), stop);
+  }
+
+  void record(double value, const Time& time)
+  {
+    Shard& shard = data->shards.local();
+
+    synchronized (shard.lock) {
+      shard.last = time;
+      shard.lastValue = value;
+
+      if (data->window.isSome()) {
+        if (shard.history.isNone()) {
+          shard.history =
+            Owned<RollingHistogram>(new RollingHistogram(data->window.get()));
+        }
+
+        shard.history.get()->add(value, time);
+      }
+    }
+  }
+
+  std::shared_ptr<Data> data;
+};
+
+} // namespace metrics {
+} // namespace process {
+
+#endif // __PROCESS_METRICS_SHARDED_TIMER_HPP__
@@ -0,0 +1,78 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#ifndef __PROCESS_METRICS_SHARDS_HPP__
+#define __PROCESS_METRICS_SHARDS_HPP__
+
+#include <stddef.h> // For size_t.
+
+#include <atomic>
+
+namespace process {
+namespace metrics {
+namespace internal {
+
+// The number of shards of a sharded metric. Threads are assigned to
+// shards round robin, so as long as no more threads than this update
+// a metric (e.g., the libprocess worker threads) none of them share a
+// shard.
+constexpr size_t SHARDS = 16;
+
+
+// Returns the shard of the calling thread.
+inline size_t shard()
+{
+  static std::atomic<size_t> next(0);
+  static thread_local size_t shard = next.fetch_add(1) % SHARDS;
+
+  return shard;
+}
+
+
+// A copy of `T` for each shard, each on cache lines of its own so
+// that threads updating their copy do not contend with each other.
+// The copies are aggregated when the metric is read.
+template <typename T>
+class Shards
+{
+public:
+  // Returns the copy of the calling thread.
+  T& local() { return shards[shard()].value; }
+
+  T& operator[](size_t i) { return shards[i].value; }
+  const T& operator[](size_t i) const { return shards[i].value; }
+
+  static constexpr size_t size() { return SHARDS; }
+
+private:
+  static constexpr size_t CACHE_LINE = 64;
+
+  // The padding keeps a cache line between any two copies, since we
+  // can not rely on the allocation being aligned to a cache line.
+  struct Padded
+  {
+    Padded() : value() {}
+
+    T value;
+    char padding[
+        CACHE_LINE + (CACHE_LINE - sizeof(T) % CACHE_LINE) % CACHE_LINE];
+  };
+
+  Padded shards[SHARDS];
+};
+
+} // namespace internal {
+} // namespace metrics {
+} // namespace process {
+
+#endif // __PROCESS_METRICS_SHARDS_HPP__
@@ -44,6 +44,9 @@ namespace process {
 class EventQueue;
 class Gate;
 class Logging;
+class Mailbox;
+class ProcessStatistics;
+class RunQueue;
 class Sequence;
 
 namespace firewall {
@@ -78,6 +81,46 @@ public:
 
   const UPID& self() const { return pid; }
 
+  /**
+   * Scheduling priorities of processes.
+   *
+   * @see process::ProcessBase::prioritize
+   */
+  enum class Priority
+  {
+    LOW,
+    NORMAL,
+    HIGH,
+  };
+
+  /**
+   * How a process with a limited mailbox handles a message that
+   * arrives while its mailbox is full.
+   *
+   * @see process::ProcessBase::limit
+   */
+  enum class Overflow
+  {
+    // Drop the message.
+    DROP,
+
+    // Drop the message and send a `MAILBOX_FULL` message back to
+    // the sender.
+    REJECT,
+
+    // Enqueue the message but stop reading from the connection it
+    // was received on until the mailbox has room again. Messages
+    // from local senders can not be held back and are enqueued.
+    BACKPRESSURE,
+  };
+
+  /**
+   * Name of the message sent back to the sender of a message that got
+   * rejected because the mailbox of the receiver was full. The body
+   * is the name of the rejected message.
+   */
+  static const std::string MAILBOX_FULL;
+
 protected:
   /**
    * Invoked when an event is serviced.
@@ -374,6 +417,49 @@ protected:
     assets[name] = asset;
   }
 
+  /**
+   * Sets the scheduling priority of this process (the default is
+   * `Priority::NORMAL`).
+   *
+   * When more processes have events to process than there are worker
+   * threads, the processes of a higher priority get run first. This
+   * is meant for latency-critical processes (and for processes doing
+   * background work, with a lower priority). A process of a lower
+   * priority is never starved though: it gets run once a bounded
+   * number of processes of a higher priority were run ahead of it.
+   *
+   * Takes effect the next time this process gets scheduled, so it is
+   * usually invoked from the constructor.
+   */
+  void prioritize(Priority priority)
+  {
+    this->priority.store(priority, std::memory_order_relaxed);
+  }
+
+  /**
+   * Limits the number of messages in the mailbox (i.e., the event
+   * queue) of this process to `capacity`. A message arriving while the
+   * mailbox is full is handled according to `overflow`, unless another
+   * policy was set for messages of that name (see below).
+   *
+   * Only messages count towards (and are subject to) the limit,
+   * dispatches, HTTP requests and other events are always enqueued.
+   * The mailbox is unbounded by default.
+   *
+   * MUST be invoked before the process is spawned, e.g., from the
+   * constructor.
+   */
+  void limit(size_t capacity, Overflow overflow = Overflow::DROP);
+
+  /**
+   * Sets how messages of the given name are handled when the mailbox
+   * of this process is full, see above.
+   *
+   * MUST be invoked after the mailbox was limited and before the
+   * process is spawned, e.g., from the constructor.
+   */
+  void limit(const std::string& name, Overflow overflow);
+
   /**
    * Returns the number of events of the given type currently on the
    * event queue. MUST be invoked from within the process itself in
@@ -385,6 +471,8 @@ protected:
 private:
   friend class SocketManager;
   friend class ProcessManager;
+  friend class PriorityQueue;
+  friend class RunQueue;
   friend void* schedule(void*);
 
   // Process states.
@@ -405,6 +493,13 @@ private:
   // Flag for indicating that a terminate event has been injected.
   std::atomic<bool> termination = ATOMIC_VAR_INIT(false);
 
+  // Index of the worker thread that last ran this process (or -1 if
+  // unknown), used by run queues that support worker affinity.
+  std::atomic<long> worker = ATOMIC_VAR_INIT(-1L);
+
+  // Scheduling priority, see `prioritize`.
+  std::atomic<Priority> priority = ATOMIC_VAR_INIT(Priority::NORMAL);
+
   // Enqueue the specified message, request, or function call.
   void enqueue(Event* event);
 
@@ -475,6 +570,15 @@ private:
 
   std::shared_ptr<Gate> gate;
 
+  // Statistics about the events of this process, only kept if the
+  // `LIBPROCESS_ENABLE_PROCESS_STATISTICS` flag is set. Shared so
+  // they can outlive the process (e.g., in metrics).
+  std::shared_ptr<ProcessStatistics> statistics;
+
+  // The limit on the mailbox of this process, if any (see `limit`).
+  // Shared so it can outlive the process (e.g., in metrics).
+  std::shared_ptr<Mailbox> mailbox;
+
   // Whether or not the runtime should delete this process after it
   // has terminated. Note that failure to spawn the process will leave
   // the process unmanaged and thus it may leak!
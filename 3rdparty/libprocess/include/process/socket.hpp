@@ -19,6 +19,8 @@
 #endif // __WINDOWS__
 
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include <process/address.hpp>
 #include <process/future.hpp>
@@ -153,6 +155,22 @@ public:
   virtual Future<size_t> send(const char* data, size_t size) = 0;
   virtual Future<size_t> sendfile(int_fd fd, off_t offset, size_t size) = 0;
 
+  /**
+   * An overload of `send`, which sends the specified buffers in order
+   * using a single vectored write (e.g., `sendmsg`) if the
+   * implementation supports it. Like `send(const char*, size_t)`,
+   * this may send only some of the data.
+   *
+   * The default implementation only sends the first buffer.
+   *
+   * @param buffers The (non-empty) data and size of each buffer. The
+   *     data must remain valid until the returned future completes.
+   *
+   * @return The total number of bytes sent.
+   */
+  virtual Future<size_t> send(
+      const std::vector<std::pair<const char*, size_t>>& buffers);
+
   /**
    * An overload of `recv`, which receives data based on the specified
    * 'size' parameter.
@@ -377,6 +395,12 @@ public:
     return impl->sendfile(fd, offset, size);
   }
 
+  Future<size_t> send(
+      const std::vector<std::pair<const char*, size_t>>& buffers) const
+  {
+    return impl->send(buffers);
+  }
+
   Future<std::string> recv(const Option<ssize_t>& size = None())
   {
     return impl->recv(size);
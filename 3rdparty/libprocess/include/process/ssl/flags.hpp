@@ -17,6 +17,7 @@
 
 #include <string>
 
+#include <stout/duration.hpp>
 #include <stout/flags.hpp>
 #include <stout/option.hpp>
 
@@ -50,6 +51,9 @@ public:
   bool enable_tls_v1_0;
   bool enable_tls_v1_1;
   bool enable_tls_v1_2;
+  bool enable_session_resumption;
+  size_t session_cache_size;
+  Duration session_timeout;
 };
 
 
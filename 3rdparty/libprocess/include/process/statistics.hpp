@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <vector>
 
+#include <process/histogram.hpp>
 #include <process/timeseries.hpp>
 
 #include <stout/foreach.hpp>
@@ -25,14 +26,15 @@
 
 namespace process {
 
-// Represents statistics for a TimeSeries of data.
+// Represents statistics for a TimeSeries or a Histogram of data.
 template <typename T>
 struct Statistics
 {
   // Returns Statistics for the given TimeSeries, or None() if the
   // TimeSeries is empty.
-  // TODO(dhamon): Consider adding a histogram abstraction for better
-  // performance.
+  //
+  // NOTE: This copies and sorts all the values of the TimeSeries; see
+  // the overload for a Histogram for cheaper, approximate statistics.
   static Option<Statistics<T>> from(const TimeSeries<T>& timeseries)
   {
     std::vector<typename TimeSeries<T>::Value> values_ = timeseries.get();
@@ -68,6 +70,33 @@ struct Statistics
     return statistics;
   }
 
+  // Returns Statistics for the given Histogram, or None() if it has
+  // fewer than 2 values. The minimum and maximum are exact while the
+  // percentiles are accurate to within `Histogram::ACCURACY`.
+  static Option<Statistics<T>> from(const Histogram& histogram)
+  {
+    // We need at least 2 values to compute aggregates.
+    if (histogram.count() < 2) {
+      return None();
+    }
+
+    Statistics statistics;
+
+    statistics.count = static_cast<size_t>(histogram.count());
+
+    statistics.min = static_cast<T>(histogram.min().get());
+    statistics.max = static_cast<T>(histogram.max().get());
+
+    statistics.p50 = static_cast<T>(histogram.quantile(0.5).get());
+    statistics.p90 = static_cast<T>(histogram.quantile(0.90).get());
+    statistics.p95 = static_cast<T>(histogram.quantile(0.95).get());
+    statistics.p99 = static_cast<T>(histogram.quantile(0.99).get());
+    statistics.p999 = static_cast<T>(histogram.quantile(0.999).get());
+    statistics.p9999 = static_cast<T>(histogram.quantile(0.9999).get());
+
+    return statistics;
+  }
+
   size_t count;
 
   T min;
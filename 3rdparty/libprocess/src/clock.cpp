@@ -24,13 +24,13 @@
 #include <process/timeout.hpp>
 
 #include <stout/duration.hpp>
-#include <stout/foreach.hpp>
 #include <stout/lambda.hpp>
 #include <stout/synchronized.hpp>
 #include <stout/try.hpp>
 #include <stout/unreachable.hpp>
 
 #include "event_loop.hpp"
+#include "timer_wheel.hpp"
 
 using std::list;
 using std::map;
@@ -39,10 +39,10 @@ using std::set;
 
 namespace process {
 
-// We store the timers in a map of lists indexed by the timeout of the
-// timer so that we can have two timers that have the same timeout. We
-// exploit that the map is SORTED!
-static map<Time, list<Timer>>* timers = new map<Time, list<Timer>>();
+// We store the timers in a hierarchical timing wheel so that creating
+// and canceling a timer is O(1) regardless of how many timers are
+// pending (see timer_wheel.hpp).
+static TimerWheel* timers = new TimerWheel();
 static recursive_mutex* timers_mutex = new recursive_mutex();
 
 
@@ -82,13 +82,12 @@ set<Time>* ticks = new set<Time>();
 // timers are expired. Note that we don't manipulate 'timers' directly
 // so that it's clear from the callsite that the use of 'timers' is
 // within a 'synchronized' block.
-//
-// TODO(benh): Create a generic 'Timers' abstraction which hides this
-// and more away (i.e., all manipulations of 'timers' below).
-Option<Time> next(const map<Time, list<Timer>>& timers)
+Option<Time> next(TimerWheel& timers)
 {
-  if (!timers.empty()) {
-    Time first = timers.begin()->first;
+  Option<Time> earliest = timers.earliest();
+
+  if (earliest.isSome()) {
+    Time first = earliest.get();
 
     // If the clock is paused and no timers are expired, the
     // timers cannot fire until the clock is advanced, so we
@@ -116,7 +115,7 @@ void tick(const Time& time);
 // a 'synchronized' block.
 // TODO(bmahler): Consider taking an optional 'now' to avoid
 // excessive syscalls via Clock::now(nullptr).
-void scheduleTick(const map<Time, list<Timer>>& timers, set<Time>* ticks)
+void scheduleTick(TimerWheel& timers, set<Time>* ticks)
 {
   // Determine when the next 'tick' should fire.
   const Option<Time> next = clock::next(timers);
@@ -151,12 +150,12 @@ void tick(const Time& time)
 
     VLOG(3) << "Handling timers up to " << now;
 
-    foreachkey (const Time& timeout, *timers) {
-      if (timeout > now) {
-        break;
-      }
+    timedout = timers->expire(now);
 
-      VLOG(3) << "Have timeout(s) at " << timeout;
+    if (!timedout.empty()) {
+      VLOG(3) << "Have " << timedout.size() << " timeout(s) from "
+              << timedout.front().timeout().time() << " to "
+              << timedout.back().timeout().time();
 
       // Need to toggle 'settling' so that we don't prematurely say
       // we're settled until after the timers are executed below,
@@ -164,15 +163,11 @@ void tick(const Time& time)
       if (clock::paused) {
         clock::settling = true;
       }
-
-      timedout.splice(timedout.end(), (*timers)[timeout]);
     }
 
-    // Now erase the range of timers that timed out.
-    timers->erase(timers->begin(), timers->upper_bound(now));
-
     // Okay, so the timeout for the next timer should not have fired.
-    CHECK(timers->empty() || (timers->begin()->first > now));
+    Option<Time> earliest = timers->earliest();
+    CHECK(earliest.isNone() || earliest.get() > now);
 
     // Remove this tick from the scheduled 'ticks', it may have
     // been removed already if the clock was paused / manipulated
@@ -191,11 +186,12 @@ void tick(const Time& time)
   // that will expire before the paused time and we've finished
   // executing expired timers.
   synchronized (timers_mutex) {
-    if (clock::paused &&
-        (timers->size() == 0 ||
-         timers->begin()->first > *clock::current)) {
-      VLOG(3) << "Clock has settled";
-      clock::settling = false;
+    if (clock::paused) {
+      Option<Time> earliest = timers->earliest();
+      if (earliest.isNone() || earliest.get() > *clock::current) {
+        VLOG(3) << "Clock has settled";
+        clock::settling = false;
+      }
     }
   }
 }
@@ -221,7 +217,7 @@ void Clock::finalize()
     // This, along with the `timers_mutex`, is all that is required to clean
     // up any pending timers.  Timers are triggered via "ticks".  However,
     // we do not need to clear `ticks` because a "tick" with an empty `timers`
-    // map will effectively be a no-op.
+    // wheel will effectively be a no-op.
     timers->clear();
   }
 }
@@ -281,17 +277,20 @@ Timer Clock::timer(
 
   // Add the timer.
   synchronized (timers_mutex) {
-    if (timers->size() == 0 ||
-        timer.timeout().time() < timers->begin()->first) {
-      // Need to interrupt the loop to update/set timer repeat.
-      (*timers)[timer.timeout().time()].push_back(timer);
+    // If there aren't any timers the wheel might not have moved in a
+    // while so we move it to the current time first. We pass nullptr
+    // because the wheel is based on global time, not per-Process time.
+    if (timers->empty()) {
+      timers->advance(Clock::now(nullptr));
+    }
 
-      // Schedule another "tick" if necessary.
+    Option<Time> earliest = timers->earliest();
+
+    timers->insert(timer.id, timer);
+
+    if (earliest.isNone() || timer.timeout().time() < earliest.get()) {
+      // Need to interrupt the loop to update/set timer repeat.
       clock::scheduleTick(*timers, clock::ticks);
-    } else {
-      // Timer repeat is adequate, just add the timeout.
-      CHECK(timers->size() >= 1);
-      (*timers)[timer.timeout().time()].push_back(timer);
     }
   }
 
@@ -301,22 +300,13 @@ Timer Clock::timer(
 
 bool Clock::cancel(const Timer& timer)
 {
-  bool canceled = false;
   synchronized (timers_mutex) {
-    // Check if the timeout is still pending, and if so, erase it. In
-    // addition, erase an empty list if we just removed the last
-    // timeout.
-    Time time = timer.timeout().time();
-    if (timers->count(time) > 0) {
-      canceled = true;
-      (*timers)[time].remove(timer);
-      if ((*timers)[time].empty()) {
-        timers->erase(time);
-      }
-    }
+    // Returns false if the timer is no longer pending (e.g., it has
+    // already fired or been canceled).
+    return timers->cancel(timer.id);
   }
 
-  return canceled;
+  UNREACHABLE();
 }
 
 
@@ -457,11 +447,12 @@ bool Clock::settled()
   synchronized (timers_mutex) {
     CHECK(clock::paused);
 
+    Option<Time> earliest = timers->earliest();
+
     if (clock::settling) {
       VLOG(3) << "Clock still not settled";
       return false;
-    } else if (timers->size() == 0 ||
-               timers->begin()->first > *clock::current) {
+    } else if (earliest.isNone() || earliest.get() > *clock::current) {
       VLOG(3) << "Clock is settled";
       return true;
     }
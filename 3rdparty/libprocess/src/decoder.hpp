@@ -21,16 +21,23 @@
 
 #include <glog/logging.h>
 
+#include <algorithm>
 #include <deque>
 #include <limits>
+#include <memory>
 #include <string>
 #include <vector>
 
+#include <process/address.hpp>
 #include <process/http.hpp>
+#include <process/message.hpp>
+#include <process/pid.hpp>
 
 #include <stout/foreach.hpp>
 #include <stout/gzip.hpp>
 #include <stout/option.hpp>
+#include <stout/result.hpp>
+#include <stout/stringify.hpp>
 #include <stout/try.hpp>
 
 
@@ -41,6 +48,29 @@
 
 namespace process {
 
+// The most that a decoder reserves up front for the body of a message
+// based on the length claimed by the peer. Larger bodies grow as the
+// data arrives, so a bogus length can't make us allocate arbitrarily.
+const size_t MESSAGE_BODY_RESERVE_LIMIT = 64 * 1024 * 1024;
+
+
+// Returns true if `request` contains an inbound libprocess message.
+// A libprocess message can either be sent by another instance of
+// libprocess (i.e. both of the "User-Agent" and "Libprocess-From"
+// headers will be set), or a client that speaks the libprocess
+// protocol (i.e. only the "Libprocess-From" header will be set).
+// This function returns true for either case.
+inline bool libprocess(const http::Request& request)
+{
+  return
+    (request.method == "POST" &&
+     request.headers.contains("User-Agent") &&
+     request.headers.at("User-Agent").find("libprocess/") == 0) ||
+    (request.method == "POST" &&
+     request.headers.contains("Libprocess-From"));
+}
+
+
 // TODO(benh): Make DataDecoder abstract and make RequestDecoder a
 // concrete subclass.
 class DataDecoder
@@ -251,13 +281,10 @@ private:
         decoder->failure = true;
         return 1;
       }
-      decoder->request->body = decompressed.get();
-
-      CHECK_LE(static_cast<long>(decoder->request->body.length()),
-        std::numeric_limits<char>::max());
+      decoder->request->body = std::move(decompressed.get());
 
       decoder->request->headers["Content-Length"] =
-        static_cast<char>(decoder->request->body.length());
+        stringify(decoder->request->body.length());
     }
 
     decoder->requests.push_back(decoder->request);
@@ -445,22 +472,25 @@ private:
       return 1;
     }
 
-    // We can only provide the gzip encoding.
+    // We can only provide the gzip and deflate encodings.
     Option<std::string> encoding =
       decoder->response->headers.get("Content-Encoding");
-    if (encoding.isSome() && encoding.get() == "gzip") {
-      Try<std::string> decompressed = gzip::decompress(decoder->response->body);
+    if (encoding.isSome() &&
+        (encoding.get() == "gzip" || encoding.get() == "deflate")) {
+      Try<std::string> decompressed = gzip::decompress(
+          decoder->response->body,
+          encoding.get() == "gzip"
+            ? gzip::Decompressor::GZIP
+            : gzip::Decompressor::ZLIB);
+
       if (decompressed.isError()) {
         decoder->failure = true;
         return 1;
       }
-      decoder->response->body = decompressed.get();
-
-      CHECK_LE(static_cast<long>(decoder->response->body.length()),
-        std::numeric_limits<char>::max());
+      decoder->response->body = std::move(decompressed.get());
 
       decoder->response->headers["Content-Length"] =
-        static_cast<char>(decoder->response->body.length());
+        stringify(decoder->response->body.length());
     }
 
     decoder->responses.push_back(decoder->response);
@@ -675,12 +705,16 @@ private:
       return 1;
     }
 
-    // We cannot provide streaming gzip decompression!
     Option<std::string> encoding =
       decoder->response->headers.get("Content-Encoding");
-    if (encoding.isSome() && encoding.get() == "gzip") {
-      decoder->failure = true;
-      return 1;
+
+    if (encoding.isSome() &&
+        (encoding.get() == "gzip" || encoding.get() == "deflate")) {
+      decoder->decompressor =
+        Owned<gzip::Decompressor>(new gzip::Decompressor(
+            encoding.get() == "gzip"
+              ? gzip::Decompressor::GZIP
+              : gzip::Decompressor::ZLIB));
     }
 
     CHECK_NONE(decoder->writer);
@@ -704,7 +738,20 @@ private:
     CHECK_SOME(decoder->writer);
 
     http::Pipe::Writer writer = decoder->writer.get(); // Remove const.
-    writer.write(std::string(data, length));
+
+    if (decoder->decompressor.get() != nullptr) {
+      Try<std::string> decompressed =
+        decoder->decompressor->decompress(std::string(data, length));
+
+      if (decompressed.isError()) {
+        decoder->failure = true;
+        return 1;
+      }
+
+      writer.write(std::move(decompressed.get()));
+    } else {
+      writer.write(std::string(data, length));
+    }
 
     return 0;
   }
@@ -724,6 +771,7 @@ private:
     writer.close();
 
     decoder->writer = None();
+    decoder->decompressor.reset();
 
     return 0;
   }
@@ -745,6 +793,9 @@ private:
   http::Response* response;
   Option<http::Pipe::Writer> writer;
 
+  // Decompresses the body of the current response, if compressed.
+  Owned<gzip::Decompressor> decompressor;
+
   std::deque<http::Response*> responses;
 };
 
@@ -858,6 +909,13 @@ private:
 
   static int on_chunk_header(http_parser* p)
   {
+    StreamingRequestDecoder* decoder = (StreamingRequestDecoder*) p->data;
+
+    // Make room for the chunk if we are buffering a message body.
+    if (decoder->request != nullptr) {
+      reserve(&decoder->request->body, p->content_length);
+    }
+
     return 0;
   }
 
@@ -972,6 +1030,20 @@ private:
 
     CHECK_NONE(decoder->writer);
 
+    // The body of a libprocess message is always read in full before
+    // the message gets delivered, so rather than streaming it through
+    // a pipe we append it to the request directly and only return the
+    // request once it is complete. This way the body is only copied
+    // once, out of the data we are decoding. See `on_body`.
+    if (decoder->decompressor.get() == nullptr &&
+        libprocess(*decoder->request)) {
+      decoder->request->type = http::Request::BODY;
+
+      reserve(&decoder->request->body, p->content_length);
+
+      return 0;
+    }
+
     http::Pipe pipe;
     decoder->writer = pipe.writer();
     decoder->request->reader = pipe.reader();
@@ -988,6 +1060,12 @@ private:
   {
     StreamingRequestDecoder* decoder = (StreamingRequestDecoder*) p->data;
 
+    if (decoder->request != nullptr) {
+      CHECK_EQ(http::Request::BODY, decoder->request->type);
+      decoder->request->body.append(data, length);
+      return 0;
+    }
+
     CHECK_SOME(decoder->writer);
 
     http::Pipe::Writer writer = decoder->writer.get(); // Remove const.
@@ -1016,6 +1094,14 @@ private:
   {
     StreamingRequestDecoder* decoder = (StreamingRequestDecoder*) p->data;
 
+    // Return a buffered message now that its body is complete.
+    if (decoder->request != nullptr && !decoder->failure) {
+      CHECK_EQ(http::Request::BODY, decoder->request->type);
+      decoder->requests.push_back(decoder->request);
+      decoder->request = nullptr;
+      return 0;
+    }
+
     // This can happen if the callback `on_headers_complete()` had failed
     // earlier (e.g., due to invalid query parameters).
     if (decoder->writer.isNone()) {
@@ -1039,6 +1125,19 @@ private:
     return 0;
   }
 
+  // Reserves room for `length` more bytes of a message body, up to
+  // `MESSAGE_BODY_RESERVE_LIMIT`.
+  static void reserve(std::string* body, uint64_t length)
+  {
+    if (length != std::numeric_limits<uint64_t>::max()) {
+      body->reserve(
+          body->size() +
+          static_cast<size_t>(std::min<uint64_t>(
+              length,
+              MESSAGE_BODY_RESERVE_LIMIT)));
+    }
+  }
+
   bool failure;
 
   http_parser parser;
@@ -1055,6 +1154,8 @@ private:
   std::string query;
   std::string url;
 
+  // The request being decoded. Once its headers are complete, this is
+  // only set while buffering the body of a libprocess message.
   http::Request* request;
   Option<http::Pipe::Writer> writer;
   Owned<gzip::Decompressor> decompressor;
@@ -1062,6 +1163,191 @@ private:
   std::deque<http::Request*> requests;
 };
 
+
+// Decodes the binary message frames produced by `MessageFrameEncoder`
+// on links that were upgraded to `MESSAGE_FRAMING_PROTOCOL`. Frames
+// may be split arbitrarily across calls to `decode`. Only a partial
+// frame header is buffered; the body of a frame is copied straight
+// into the body of its message.
+class MessageFrameDecoder
+{
+public:
+  // Decoded messages are addressed to processes at `_address`, since
+  // a frame only carries the ID of its receiver.
+  explicit MessageFrameDecoder(const network::inet::Address& _address)
+    : failure(false), address(_address), remaining(0) {}
+
+  std::deque<Message*> decode(const char* data, size_t length)
+  {
+    std::deque<Message*> messages;
+
+    while (!failure) {
+      // Start a new message once we have the whole header of a frame.
+      if (message.get() == nullptr) {
+        if (length == 0) {
+          break;
+        }
+
+        // Avoid copying into the buffer when we are not in the middle
+        // of a header, which is the common case.
+        const size_t buffered = buffer.size();
+
+        Result<size_t> header = None();
+        if (buffered == 0) {
+          header = parse(data, length);
+        } else {
+          buffer.append(data, length);
+          header = parse(buffer.data(), buffer.size());
+        }
+
+        if (header.isError()) {
+          failure = true;
+          break;
+        } else if (header.isNone()) {
+          if (buffered == 0) {
+            buffer.assign(data, length);
+          }
+          break;
+        }
+
+        // Anything we buffered beyond the header gets copied into the
+        // body from `data` below.
+        const size_t consumed = header.get() - buffered;
+
+        buffer.clear();
+
+        data += consumed;
+        length -= consumed;
+      }
+
+      // Copy as much of the body as we have.
+      const size_t size = std::min(length, remaining);
+      body.append(data, size);
+
+      data += size;
+      length -= size;
+      remaining -= size;
+
+      if (remaining > 0) {
+        break; // Wait for the rest of the body.
+      }
+
+      message->body = std::move(body);
+      messages.push_back(message.release());
+      body = std::string();
+    }
+
+    return messages;
+  }
+
+  bool failed() const
+  {
+    return failure;
+  }
+
+private:
+  static uint32_t read(const char* data)
+  {
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(data);
+
+    return (static_cast<uint32_t>(bytes[0]) << 24) |
+           (static_cast<uint32_t>(bytes[1]) << 16) |
+           (static_cast<uint32_t>(bytes[2]) << 8) |
+           static_cast<uint32_t>(bytes[3]);
+  }
+
+  // Reads a length-prefixed string at `*offset` of `data`, which holds
+  // the first `length` bytes of a frame of `size` bytes (not counting
+  // its own length prefix). Returns an error if the string extends
+  // past the end of the frame, or none if it extends past `length`.
+  static Result<std::string> read(
+      const char* data,
+      size_t length,
+      size_t size,
+      size_t* offset)
+  {
+    if (size - (*offset - sizeof(uint32_t)) < sizeof(uint32_t)) {
+      return Error("Field length extends past the end of the frame");
+    } else if (length - *offset < sizeof(uint32_t)) {
+      return None();
+    }
+
+    const uint32_t field = read(data + *offset);
+
+    if (size - (*offset - sizeof(uint32_t)) - sizeof(uint32_t) < field) {
+      return Error("Field extends past the end of the frame");
+    } else if (length - *offset - sizeof(uint32_t) < field) {
+      return None();
+    }
+
+    *offset += sizeof(uint32_t);
+
+    std::string value(data + *offset, field);
+    *offset += field;
+
+    return value;
+  }
+
+  // Parses the header of a frame (i.e., everything but the body) from
+  // the start of `data`, and starts decoding its message. Returns the
+  // size of the header, none if `data` doesn't hold all of it yet, or
+  // an error if the frame is malformed.
+  Result<size_t> parse(const char* data, size_t length)
+  {
+    if (length < sizeof(uint32_t)) {
+      return None();
+    }
+
+    const uint32_t size = read(data);
+
+    size_t offset = sizeof(uint32_t);
+
+    Result<std::string> from = read(data, length, size, &offset);
+    if (from.isError()) {
+      return Error(from.error());
+    } else if (from.isNone()) {
+      return None();
+    }
+
+    Result<std::string> to = read(data, length, size, &offset);
+    if (to.isError()) {
+      return Error(to.error());
+    } else if (to.isNone()) {
+      return None();
+    }
+
+    Result<std::string> name = read(data, length, size, &offset);
+    if (name.isError()) {
+      return Error(name.error());
+    } else if (name.isNone()) {
+      return None();
+    }
+
+    message.reset(new Message());
+    message->name = std::move(name.get());
+    message->from = UPID(from.get());
+    message->to = UPID(to.get(), address);
+
+    remaining = size - (offset - sizeof(uint32_t));
+
+    body.reserve(std::min(remaining, MESSAGE_BODY_RESERVE_LIMIT));
+
+    return offset;
+  }
+
+  bool failure;
+  const network::inet::Address address;
+
+  // A partial frame header.
+  std::string buffer;
+
+  // The message being decoded and the part of its body we have so
+  // far, once we have the header of its frame.
+  std::unique_ptr<Message> message;
+  std::string body;
+  size_t remaining;
+};
+
 }  // namespace process {
 
 #endif // __DECODER_HPP__
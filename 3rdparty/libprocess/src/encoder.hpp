@@ -21,6 +21,7 @@
 #include <sstream>
 
 #include <process/http.hpp>
+#include <process/owned.hpp>
 #include <process/process.hpp>
 
 #include <stout/foreach.hpp>
@@ -34,6 +35,49 @@ namespace process {
 
 const uint32_t GZIP_MINIMUM_BODY_LENGTH = 1024;
 
+
+// Settings for compressing HTTP responses, which `process::initialize`
+// sets from the `LIBPROCESS_HTTP_COMPRESSION_LEVEL` and
+// `LIBPROCESS_HTTP_COMPRESSION_MIN_SIZE` environment variables.
+struct HttpCompression
+{
+  // Returns the content coding to compress the response to the
+  // request with, if any. When the client accepts both "gzip" and
+  // "deflate" we use "gzip", regardless of their quality values.
+  static Option<std::string> encoding(const http::Request& request)
+  {
+    if (level == Z_NO_COMPRESSION) {
+      return None();
+    } else if (request.acceptsEncoding("gzip")) {
+      return std::string("gzip");
+    } else if (request.acceptsEncoding("deflate")) {
+      return std::string("deflate");
+    }
+
+    return None();
+  }
+
+  // Returns a compressor for the content coding returned by
+  // `encoding`.
+  static Owned<gzip::Compressor> compressor(const std::string& encoding)
+  {
+    return Owned<gzip::Compressor>(new gzip::Compressor(
+        level,
+        encoding == "gzip"
+          ? gzip::Compressor::GZIP
+          : gzip::Compressor::ZLIB));
+  }
+
+  // The zlib compression level, or `Z_NO_COMPRESSION` to not compress
+  // responses at all.
+  static int level;
+
+  // The length below which response bodies are not compressed.
+  // Streamed responses are only compressed if they opt in (see
+  // `http::Response::compress`), regardless of their length.
+  static size_t minimum;
+};
+
 // Forward declarations.
 class Encoder;
 
@@ -140,6 +184,72 @@ public:
 };
 
 
+// The HTTP 'Upgrade' protocol that libprocess peers use to switch a
+// link from HTTP to binary message frames (see `MessageFrameEncoder`).
+const char MESSAGE_FRAMING_PROTOCOL[] = "libprocess-frames/1";
+
+
+// Encodes a message as a length-prefixed binary frame rather than as
+// an HTTP request. This is only used on links where the peer agreed
+// to upgrade to `MESSAGE_FRAMING_PROTOCOL`. A frame consists of:
+//
+//   uint32  length of the remainder of the frame
+//   uint32  length of 'from', followed by 'from' (i.e., "id@ip:port")
+//   uint32  length of 'to.id', followed by 'to.id'
+//   uint32  length of 'name', followed by 'name'
+//   ...     the body (i.e., the rest of the frame)
+//
+// All integers are in network byte order. See `MessageFrameDecoder`.
+class MessageFrameEncoder : public DataEncoder
+{
+public:
+  MessageFrameEncoder(const Message& message)
+    : DataEncoder(encode(message)) {}
+
+  static std::string encode(const Message& message)
+  {
+    const std::string from = stringify(message.from);
+    const std::string& to = message.to.id;
+
+    const size_t length =
+      3 * sizeof(uint32_t) +
+      from.size() +
+      to.size() +
+      message.name.size() +
+      message.body.size();
+
+    CHECK_LE(length, std::numeric_limits<uint32_t>::max())
+      << "Message '" << message.name << "' is too large to frame";
+
+    std::string frame;
+    frame.reserve(sizeof(uint32_t) + length);
+
+    append(&frame, static_cast<uint32_t>(length));
+    append(&frame, from);
+    append(&frame, to);
+    append(&frame, message.name);
+    frame.append(message.body);
+
+    return frame;
+  }
+
+private:
+  static void append(std::string* frame, uint32_t value)
+  {
+    frame->push_back(static_cast<char>((value >> 24) & 0xff));
+    frame->push_back(static_cast<char>((value >> 16) & 0xff));
+    frame->push_back(static_cast<char>((value >> 8) & 0xff));
+    frame->push_back(static_cast<char>(value & 0xff));
+  }
+
+  static void append(std::string* frame, const std::string& value)
+  {
+    append(frame, static_cast<uint32_t>(value.size()));
+    frame->append(value);
+  }
+};
+
+
 class HttpResponseEncoder : public DataEncoder
 {
 public:
@@ -179,23 +289,34 @@ public:
     headers["Date"] = date;
 
     // Should we compress this response?
-    std::string body = response.body;
+    Option<std::string> compressed = None();
 
+    Option<std::string> encoding = None();
     if (response.type == http::Response::BODY &&
-        response.body.length() >= GZIP_MINIMUM_BODY_LENGTH &&
-        !headers.contains("Content-Encoding") &&
-        request.acceptsEncoding("gzip")) {
-      Try<std::string> compressed = gzip::compress(body);
-      if (compressed.isError()) {
-        LOG(WARNING) << "Failed to gzip response body: " << compressed.error();
+        response.body.length() >= HttpCompression::minimum &&
+        !headers.contains("Content-Encoding")) {
+      encoding = HttpCompression::encoding(request);
+    }
+
+    if (encoding.isSome()) {
+      Try<std::string> compress =
+        HttpCompression::compressor(encoding.get())->finish(response.body);
+
+      if (compress.isError()) {
+        LOG(WARNING) << "Failed to " << encoding.get()
+                     << " response body: " << compress.error();
       } else {
-        body = std::move(compressed.get());
+        compressed = std::move(compress.get());
 
-        headers["Content-Length"] = stringify(body.length());
-        headers["Content-Encoding"] = "gzip";
+        headers["Content-Length"] = stringify(compressed->length());
+        headers["Content-Encoding"] = encoding.get();
       }
     }
 
+    // Avoid copying the body unless we compressed it.
+    const std::string& body =
+      compressed.isSome() ? compressed.get() : response.body;
+
     foreachpair (const std::string& key, const std::string& value, headers) {
       out << key << ": " << value << "\r\n";
     }
@@ -24,8 +24,14 @@ namespace process {
 class EventLoop
 {
 public:
-  // Initializes the event loop.
-  static void initialize();
+  // Initializes the specified number of event loops. Sockets are
+  // sharded across the event loops (by file descriptor) while timers
+  // always use the first event loop. Implementations that only
+  // support a single event loop will ignore any additional loops.
+  static void initialize(size_t loops);
+
+  // Returns the number of initialized event loops.
+  static size_t loops();
 
   // Invoke the specified function in the event loop after the
   // specified duration.
@@ -37,10 +43,10 @@ public:
   // Returns the current time w.r.t. the event loop.
   static double time();
 
-  // Runs the event loop.
-  static void run();
+  // Runs the specified event loop, in [0, `loops()`).
+  static void run(size_t loop);
 
-  // Asynchronously tells the event loop to stop and then returns.
+  // Asynchronously tells all event loops to stop and then returns.
   static void stop();
 };
 
@@ -0,0 +1,306 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#include <math.h>
+
+#include <algorithm>
+#include <limits>
+
+#include <glog/logging.h>
+
+#include <process/histogram.hpp>
+
+#include <stout/foreach.hpp>
+
+namespace process {
+
+const double Histogram::ACCURACY = 0.01;
+const size_t Histogram::BUCKETS = 1024;
+
+
+// The base of the logarithm used for the keys, which makes the value
+// a bucket represents (see `value`) within `ACCURACY` of all the
+// values in the bucket.
+static const double GAMMA =
+  (1 + Histogram::ACCURACY) / (1 - Histogram::ACCURACY);
+static const double LOG_GAMMA = ::log(GAMMA);
+
+
+// Bounds the keys so that computing with them can not overflow.
+static const int MAX_KEY = 1 << 24;
+
+
+Histogram::Histogram()
+  : zeros(0),
+    total(0),
+    minimum(0),
+    maximum(0) {}
+
+
+int Histogram::key(double magnitude)
+{
+  const double key = ::ceil(::log(magnitude) / LOG_GAMMA);
+
+  return static_cast<int>(
+      std::max(std::min(key, static_cast<double>(MAX_KEY)),
+               static_cast<double>(-MAX_KEY)));
+}
+
+
+double Histogram::value(int key)
+{
+  // The midpoint (relative) of the bucket's bounds, i.e.,
+  // (GAMMA^(key-1), GAMMA^key].
+  return 2 * ::pow(GAMMA, key) / (GAMMA + 1);
+}
+
+
+void Histogram::add(double value)
+{
+  if (::isnan(value)) {
+    return;
+  }
+
+  if (value >= std::numeric_limits<double>::min()) {
+    positive.add(key(value), 1);
+  } else if (value <= -std::numeric_limits<double>::min()) {
+    negative.add(key(-value), 1);
+  } else {
+    zeros++;
+  }
+
+  minimum = total == 0 ? value : std::min(minimum, value);
+  maximum = total == 0 ? value : std::max(maximum, value);
+
+  total++;
+}
+
+
+void Histogram::merge(const Histogram& that)
+{
+  if (that.total == 0) {
+    return;
+  }
+
+  positive.merge(that.positive);
+  negative.merge(that.negative);
+  zeros += that.zeros;
+
+  minimum = total == 0 ? that.minimum : std::min(minimum, that.minimum);
+  maximum = total == 0 ? that.maximum : std::max(maximum, that.maximum);
+
+  total += that.total;
+}
+
+
+Option<double> Histogram::min() const
+{
+  if (total == 0) {
+    return None();
+  }
+
+  return minimum;
+}
+
+
+Option<double> Histogram::max() const
+{
+  if (total == 0) {
+    return None();
+  }
+
+  return maximum;
+}
+
+
+double Histogram::rank(uint64_t rank) const
+{
+  CHECK_LT(rank, total);
+
+  // The negative values come first, in the reverse order of their
+  // magnitudes.
+  if (rank < negative.count()) {
+    return -value(negative.key(negative.count() - 1 - rank));
+  }
+
+  rank -= negative.count();
+
+  if (rank < zeros) {
+    return 0;
+  }
+
+  rank -= zeros;
+
+  return value(positive.key(rank));
+}
+
+
+Option<double> Histogram::quantile(double q) const
+{
+  if (total == 0) {
+    return None();
+  }
+
+  if (q <= 0.0 || total == 1) {
+    return minimum;
+  }
+
+  if (q >= 1.0) {
+    return maximum;
+  }
+
+  const double position = q * (total - 1);
+  const uint64_t index = static_cast<uint64_t>(::floor(position));
+  const double delta = position - index;
+
+  const double lower = rank(index);
+  const double upper = index + 1 < total ? rank(index + 1) : lower;
+
+  // The extremes are known exactly, which also keeps the result
+  // within the bounds when the buckets have been collapsed.
+  return std::max(minimum,
+                  std::min(maximum, lower + delta * (upper - lower)));
+}
+
+
+void Histogram::Store::add(int key, uint64_t count)
+{
+  if (count == 0) {
+    return;
+  }
+
+  if (counts.empty()) {
+    // Center the window on the first key.
+    counts.assign(BUCKETS, 0);
+    offset = key - static_cast<int>(BUCKETS / 2);
+    lowest = highest = key;
+  } else if (key < offset || key >= offset + static_cast<int>(BUCKETS)) {
+    key = extend(key);
+  }
+
+  counts[key - offset] += count;
+
+  lowest = std::min(lowest, key);
+  highest = std::max(highest, key);
+  total += count;
+}
+
+
+int Histogram::Store::extend(int key)
+{
+  const int low = std::min(lowest, key);
+  const int high = std::max(highest, key);
+  const int buckets = static_cast<int>(BUCKETS);
+
+  int offset_;
+
+  if (high - low < buckets) {
+    // Center the keys in the window to leave room on both sides.
+    offset_ = low - (buckets - (high - low + 1)) / 2;
+  } else {
+    // Keep the highest keys and collapse the lowest ones into the
+    // lowest bucket of the window.
+    offset_ = high - buckets + 1;
+  }
+
+  std::vector<uint64_t> counts_(BUCKETS, 0);
+
+  for (int k = lowest; k <= highest; k++) {
+    counts_[std::max(k, offset_) - offset_] += counts[k - offset];
+  }
+
+  counts.swap(counts_);
+  offset = offset_;
+  lowest = std::max(lowest, offset);
+
+  return std::max(key, offset);
+}
+
+
+void Histogram::Store::merge(const Store& that)
+{
+  if (that.total == 0) {
+    return;
+  }
+
+  for (int k = that.lowest; k <= that.highest; k++) {
+    add(k, that.counts[k - that.offset]);
+  }
+}
+
+
+int Histogram::Store::key(uint64_t rank) const
+{
+  CHECK_LT(rank, total);
+
+  for (int k = lowest; k < highest; k++) {
+    const uint64_t count = counts[k - offset];
+
+    if (rank < count) {
+      return k;
+    }
+
+    rank -= count;
+  }
+
+  return highest;
+}
+
+
+RollingHistogram::RollingHistogram(const Duration& window, size_t intervals)
+  : duration(window / std::max(intervals, static_cast<size_t>(1))),
+    histograms(std::max(intervals, static_cast<size_t>(1))),
+    indices(histograms.size()) {}
+
+
+int64_t RollingHistogram::interval(const Time& time) const
+{
+  return time.duration().ns() /
+    std::max(duration.ns(), static_cast<int64_t>(1));
+}
+
+
+void RollingHistogram::add(double value, const Time& time)
+{
+  const int64_t index = interval(time);
+  const size_t i = static_cast<size_t>(index % histograms.size());
+
+  // Reuse the histogram of an interval that has left the window.
+  if (indices[i] != index) {
+    histograms[i] = Histogram();
+    indices[i] = index;
+  }
+
+  histograms[i].add(value);
+}
+
+
+Histogram RollingHistogram::get(const Time& time) const
+{
+  const int64_t index = interval(time);
+  const int64_t size = static_cast<int64_t>(histograms.size());
+
+  Histogram histogram;
+
+  for (size_t i = 0; i < histograms.size(); i++) {
+    if (indices[i].isSome() &&
+        indices[i].get() <= index &&
+        indices[i].get() > index - size) {
+      histogram.merge(histograms[i]);
+    }
+  }
+
+  return histogram;
+}
+
+} // namespace process {
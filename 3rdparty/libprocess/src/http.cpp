@@ -31,8 +31,10 @@
 #include <tuple>
 #include <vector>
 
+#include <process/clock.hpp>
 #include <process/collect.hpp>
 #include <process/defer.hpp>
+#include <process/delay.hpp>
 #include <process/dispatch.hpp>
 #include <process/future.hpp>
 #include <process/http.hpp>
@@ -44,6 +46,10 @@
 #include <process/queue.hpp>
 #include <process/socket.hpp>
 
+#include <process/metrics/counter.hpp>
+#include <process/metrics/metrics.hpp>
+#include <process/metrics/push_gauge.hpp>
+
 #include <stout/foreach.hpp>
 #include <stout/ip.hpp>
 #include <stout/lambda.hpp>
@@ -1468,6 +1474,393 @@ Future<Connection> connect(const URL& url)
 }
 
 
+namespace internal {
+
+class ConnectionPoolProcess : public Process<ConnectionPoolProcess>
+{
+public:
+  ConnectionPoolProcess(
+      const string& name,
+      const ConnectionPool::Options& _options)
+    : ProcessBase(ID::generate("__http_connection_pool__")),
+      options(_options),
+      metrics(name),
+      nextId(0) {}
+
+  Future<Response> send(Request request)
+  {
+    const URL& url = request.url;
+
+    if ((url.ip.isNone() && url.domain.isNone()) || url.port.isNone()) {
+      return Failure("Expected URL.ip or URL.domain and URL.port to be set");
+    }
+
+    const string key =
+      url.scheme.getOrElse("http") + "://" +
+      (url.domain.isSome() ? url.domain.get() : stringify(url.ip.get())) +
+      ":" + stringify(url.port.get());
+
+    request.keepAlive = true;
+
+    Owned<Promise<Response>> promise(new Promise<Response>());
+    Future<Response> response = promise->future();
+
+    hosts[key].pending.push_back(Pending(request, promise));
+
+    schedule(key);
+
+    return response;
+  }
+
+protected:
+  virtual void finalize()
+  {
+    foreachvalue (Host& host, hosts) {
+      while (!host.pending.empty()) {
+        host.pending.front().promise->fail("Connection pool was destructed");
+        host.pending.pop_front();
+      }
+
+      foreachvalue (Slot& slot, host.connections) {
+        if (slot.connection.isSome()) {
+          slot.connection->disconnect();
+          --metrics.connections;
+        }
+      }
+    }
+
+    hosts.clear();
+  }
+
+private:
+  // A pooled connection, `connection` is none while connecting.
+  struct Slot
+  {
+    Slot() : requests(0), inflight(0) {}
+
+    Option<Connection> connection;
+    size_t requests; // Sent on this connection so far.
+    size_t inflight;
+    Time idle; // Since when there are no requests in flight.
+  };
+
+  // A request waiting for a connection.
+  struct Pending
+  {
+    Pending(const Request& _request, const Owned<Promise<Response>>& _promise)
+      : request(_request), promise(_promise), retry(false) {}
+
+    Request request;
+    Owned<Promise<Response>> promise;
+
+    // Whether this retries a request that failed on an idle connection
+    // (see `completed`), which then needs a connection not used before.
+    bool retry;
+  };
+
+  struct Host
+  {
+    hashmap<uint64_t, Slot> connections;
+    deque<Pending> pending;
+  };
+
+  // Returns whether the server closes the connection after the
+  // response. Note that header values are case-insensitive.
+  static bool closing(const Response& response)
+  {
+    Option<string> connection = response.headers.get("Connection");
+    if (connection.isNone()) {
+      return false;
+    }
+
+    foreach (const string& token, strings::tokenize(connection.get(), ",")) {
+      if (strings::lower(strings::trim(token)) == "close") {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  // Sends as many of the pending requests to the server as there are
+  // connections that can take them, and opens more connections if
+  // the remaining ones are not covered by the connections that are
+  // already being opened.
+  void schedule(const string& key)
+  {
+    CHECK(hosts.contains(key));
+    Host& host = hosts.at(key);
+
+    size_t connecting = 0;
+
+    while (!host.pending.empty()) {
+      const Pending pending = host.pending.front();
+
+      // Pick the connection with the fewest requests in flight. A
+      // retried request only goes to a connection that is not used yet.
+      Option<uint64_t> id = None();
+      connecting = 0;
+
+      foreachpair (uint64_t id_, const Slot& slot, host.connections) {
+        if (slot.connection.isNone()) {
+          connecting++;
+        } else if (slot.inflight < options.maxPipelinedRequests &&
+                   (!pending.retry || slot.requests == 0) &&
+                   (id.isNone() ||
+                    slot.inflight < host.connections.at(id.get()).inflight)) {
+          id = id_;
+        }
+      }
+
+      if (id.isNone()) {
+        break;
+      }
+
+      host.pending.pop_front();
+
+      Slot& slot = host.connections.at(id.get());
+
+      // The server might have closed an idle connection before it
+      // learns about this request, see `completed`.
+      const bool idle = slot.requests > 0 && slot.inflight == 0;
+
+      if (slot.requests++ == 0) {
+        ++metrics.misses;
+      } else {
+        ++metrics.hits;
+      }
+
+      slot.inflight++;
+
+      slot.connection->send(pending.request)
+        .onAny(defer(self(),
+                     &Self::completed,
+                     key,
+                     id.get(),
+                     pending,
+                     idle,
+                     lambda::_1));
+    }
+
+    while (host.pending.size() > connecting * options.maxPipelinedRequests &&
+           host.connections.size() < options.maxConnections) {
+      const uint64_t id = nextId++;
+
+      host.connections[id] = Slot();
+      connecting++;
+
+      http::connect(host.pending.front().request.url)
+        .onAny(defer(self(), &Self::connected, key, id, lambda::_1));
+    }
+
+    if (host.pending.empty() && host.connections.empty()) {
+      hosts.erase(key);
+    }
+  }
+
+  void connected(
+      const string& key,
+      uint64_t id,
+      const Future<Connection>& connection)
+  {
+    CHECK(hosts.contains(key));
+    Host& host = hosts.at(key);
+
+    CHECK(host.connections.contains(id));
+
+    if (!connection.isReady()) {
+      host.connections.erase(id);
+
+      // Fail the pending requests unless another connection to the
+      // server can still take them.
+      if (host.connections.empty()) {
+        const string message = "Failed to connect: " +
+          (connection.isFailed() ? connection.failure() : "discarded");
+
+        while (!host.pending.empty()) {
+          host.pending.front().promise->fail(message);
+          host.pending.pop_front();
+        }
+      }
+
+      schedule(key);
+      return;
+    }
+
+    Slot& slot = host.connections.at(id);
+    slot.connection = connection.get();
+    slot.idle = Clock::now();
+
+    ++metrics.connections;
+
+    slot.connection->disconnected()
+      .onAny(defer(self(), &Self::remove, key, id));
+
+    expire(key, id);
+    schedule(key);
+  }
+
+  void completed(
+      const string& key,
+      uint64_t id,
+      Pending pending,
+      bool idle,
+      const Future<Response>& response)
+  {
+    // A request that failed on a connection that was idle is retried
+    // once on a new connection, as the server has likely closed the
+    // idle connection while the request was sent.
+    const bool retry = response.isFailed() && idle && !pending.retry;
+
+    if (retry) {
+      pending.retry = true;
+      hosts[key].pending.push_front(pending);
+    } else {
+      pending.promise->associate(response);
+    }
+
+    if (!hosts.contains(key) || !hosts.at(key).connections.contains(id)) {
+      if (retry) {
+        schedule(key);
+      }
+
+      return; // Already disconnected.
+    }
+
+    Slot& slot = hosts.at(key).connections.at(id);
+
+    // Don't send any more requests on a connection that failed or
+    // that the server is about to close.
+    if (!response.isReady() || closing(response.get())) {
+      slot.connection->disconnect();
+      remove(key, id);
+      return;
+    }
+
+    CHECK(slot.inflight > 0);
+
+    if (--slot.inflight == 0) {
+      slot.idle = Clock::now();
+      delay(options.idleTimeout, self(), &Self::expire, key, id);
+    }
+
+    schedule(key);
+  }
+
+  // Closes the connection if it has been idle for the idle timeout.
+  void expire(const string& key, uint64_t id)
+  {
+    if (!hosts.contains(key) || !hosts.at(key).connections.contains(id)) {
+      return; // Already disconnected.
+    }
+
+    Slot& slot = hosts.at(key).connections.at(id);
+
+    if (slot.inflight > 0) {
+      return;
+    }
+
+    const Duration idle = Clock::now() - slot.idle;
+
+    if (idle < options.idleTimeout) {
+      delay(options.idleTimeout - idle, self(), &Self::expire, key, id);
+      return;
+    }
+
+    slot.connection->disconnect();
+
+    remove(key, id);
+  }
+
+  void remove(const string& key, uint64_t id)
+  {
+    if (!hosts.contains(key) || !hosts.at(key).connections.contains(id)) {
+      return; // Already removed.
+    }
+
+    hosts.at(key).connections.erase(id);
+
+    --metrics.connections;
+
+    schedule(key);
+  }
+
+  struct Metrics
+  {
+    explicit Metrics(const string& name)
+      : hits("libprocess/http/connection_pools/" + name + "/hits"),
+        misses("libprocess/http/connection_pools/" + name + "/misses"),
+        connections(
+            "libprocess/http/connection_pools/" + name + "/connections")
+    {
+      process::metrics::add(hits);
+      process::metrics::add(misses);
+      process::metrics::add(connections);
+    }
+
+    ~Metrics()
+    {
+      process::metrics::remove(hits);
+      process::metrics::remove(misses);
+      process::metrics::remove(connections);
+    }
+
+    process::metrics::Counter hits;
+    process::metrics::Counter misses;
+    process::metrics::PushGauge connections;
+  };
+
+  const ConnectionPool::Options options;
+
+  Metrics metrics;
+
+  uint64_t nextId;
+
+  hashmap<string, Host> hosts;
+};
+
+} // namespace internal {
+
+
+struct ConnectionPool::Data
+{
+  // See `Connection::Data`.
+  Data(const string& name, const Options& options)
+    : process(spawn(
+          new internal::ConnectionPoolProcess(name, options),
+          true)) {}
+
+  ~Data()
+  {
+    terminate(process, false);
+  }
+
+  PID<internal::ConnectionPoolProcess> process;
+};
+
+
+ConnectionPool::ConnectionPool(const string& name, const Options& options)
+  : data(std::make_shared<ConnectionPool::Data>(name, options)) {}
+
+
+Future<Response> ConnectionPool::send(
+    const Request& request,
+    bool streamedResponse)
+{
+  if (streamedResponse) {
+    Request request_ = request;
+    request_.keepAlive = false;
+
+    return http::request(request_, true);
+  }
+
+  return dispatch(
+      data->process,
+      &internal::ConnectionPoolProcess::send,
+      request);
+}
+
+
 namespace internal {
 
 Future<Nothing> send(network::Socket socket, Encoder* encoder)
@@ -0,0 +1,713 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#include <endian.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+
+#include <ev.h>
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include <process/future.hpp>
+#include <process/io.hpp>
+
+#include <stout/error.hpp>
+#include <stout/foreach.hpp>
+#include <stout/hashmap.hpp>
+#include <stout/hashset.hpp>
+#include <stout/lambda.hpp>
+#include <stout/nothing.hpp>
+#include <stout/option.hpp>
+
+#include <stout/os/close.hpp>
+#include <stout/os/strerror.hpp>
+
+#include "io_uring.hpp"
+#include "libev.hpp"
+
+namespace process {
+namespace io_uring {
+
+// The number of submission queue entries of each ring. Operations
+// that don't fit are kept in a backlog until entries become free.
+constexpr unsigned ENTRIES = 256;
+
+
+// The `user_data` of cancellations, whose completions are ignored.
+constexpr uint64_t CANCELLATION = 0;
+
+
+namespace internal {
+
+int setup(unsigned entries, struct io_uring_params* params)
+{
+  return static_cast<int>(::syscall(__NR_io_uring_setup, entries, params));
+}
+
+
+int enter(int fd, unsigned submit)
+{
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_enter, fd, submit, 0, 0, nullptr, 0));
+}
+
+
+int register_(int fd, unsigned opcode, const void* arg, unsigned args)
+{
+  return static_cast<int>(
+      ::syscall(__NR_io_uring_register, fd, opcode, arg, args));
+}
+
+
+void* map(int fd, size_t size, off_t offset)
+{
+  void* address = ::mmap(
+      nullptr,
+      size,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED | MAP_POPULATE,
+      fd,
+      offset);
+
+  return address == MAP_FAILED ? nullptr : address;
+}
+
+} // namespace internal {
+
+
+Try<Ring*> Ring::create(unsigned entries)
+{
+  struct io_uring_params params;
+  memset(&params, 0, sizeof(params));
+
+  int fd = internal::setup(entries, &params);
+  if (fd < 0) {
+    return ErrnoError("Failed to set up io_uring");
+  }
+
+  // We rely on the kernel to wait for file descriptors that are not
+  // ready (e.g., a socket without any data) rather than failing the
+  // operation, and on it never dropping completions.
+  if ((params.features & IORING_FEAT_FAST_POLL) == 0 ||
+      (params.features & IORING_FEAT_NODROP) == 0) {
+    os::close(fd);
+    return Error(
+        "io_uring does not support IORING_FEAT_FAST_POLL and"
+        " IORING_FEAT_NODROP (requires Linux 5.7 or newer)");
+  }
+
+  Ring* ring = new Ring();
+  ring->fd = fd;
+
+  ring->sq.size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+  ring->cq.size =
+    params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe);
+
+  if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+    ring->sq.size = ring->cq.size = std::max(ring->sq.size, ring->cq.size);
+  }
+
+  ring->sq.ring = internal::map(fd, ring->sq.size, IORING_OFF_SQ_RING);
+  if (ring->sq.ring == nullptr) {
+    ErrnoError error("Failed to map io_uring submission queue");
+    delete ring;
+    return error;
+  }
+
+  if ((params.features & IORING_FEAT_SINGLE_MMAP) != 0) {
+    ring->cq.ring = ring->sq.ring;
+  } else {
+    ring->cq.ring = internal::map(fd, ring->cq.size, IORING_OFF_CQ_RING);
+    if (ring->cq.ring == nullptr) {
+      ErrnoError error("Failed to map io_uring completion queue");
+      delete ring;
+      return error;
+    }
+  }
+
+  ring->sq.sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+  ring->sq.sqes = static_cast<struct io_uring_sqe*>(
+      internal::map(fd, ring->sq.sqesSize, IORING_OFF_SQES));
+
+  if (ring->sq.sqes == nullptr) {
+    ErrnoError error("Failed to map io_uring submission queue entries");
+    delete ring;
+    return error;
+  }
+
+  char* sq = static_cast<char*>(ring->sq.ring);
+  ring->sq.head = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+  ring->sq.tail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+  ring->sq.mask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+  ring->sq.array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+  ring->sq.entries = params.sq_entries;
+  ring->sq.local = *ring->sq.tail;
+
+  char* cq = static_cast<char*>(ring->cq.ring);
+  ring->cq.head = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+  ring->cq.tail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+  ring->cq.mask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+  ring->cq.cqes =
+    reinterpret_cast<struct io_uring_cqe*>(cq + params.cq_off.cqes);
+
+  return ring;
+}
+
+
+Ring::~Ring()
+{
+  if (sq.sqes != nullptr) {
+    ::munmap(sq.sqes, sq.sqesSize);
+  }
+
+  if (cq.ring != nullptr && cq.ring != sq.ring) {
+    ::munmap(cq.ring, cq.size);
+  }
+
+  if (sq.ring != nullptr) {
+    ::munmap(sq.ring, sq.size);
+  }
+
+  // NOTE: Closing the ring cancels any operations that are still in
+  // progress.
+  if (fd >= 0) {
+    os::close(fd);
+  }
+}
+
+
+struct io_uring_sqe* Ring::sqe()
+{
+  const unsigned head = __atomic_load_n(sq.head, __ATOMIC_ACQUIRE);
+
+  if (sq.local - head >= sq.entries) {
+    return nullptr;
+  }
+
+  const unsigned index = sq.local & *sq.mask;
+
+  struct io_uring_sqe* sqe = &sq.sqes[index];
+  memset(sqe, 0, sizeof(*sqe));
+
+  sq.array[index] = index;
+  sq.local++;
+
+  return sqe;
+}
+
+
+unsigned Ring::pending() const
+{
+  return sq.local - __atomic_load_n(sq.head, __ATOMIC_ACQUIRE);
+}
+
+
+Try<Nothing> Ring::submit()
+{
+  __atomic_store_n(sq.tail, sq.local, __ATOMIC_RELEASE);
+
+  while (internal::enter(fd, pending()) < 0) {
+    if (errno == EINTR) {
+      continue;
+    }
+
+    // The kernel is short on memory or has too many completions that
+    // we haven't reaped yet, the entries are submitted next time.
+    if (errno == EAGAIN || errno == EBUSY) {
+      break;
+    }
+
+    return ErrnoError("Failed to submit to io_uring");
+  }
+
+  return Nothing();
+}
+
+
+Try<Nothing> Ring::registerEventfd(int eventfd)
+{
+  if (internal::register_(fd, IORING_REGISTER_EVENTFD, &eventfd, 1) < 0) {
+    return ErrnoError("Failed to register eventfd with io_uring");
+  }
+
+  return Nothing();
+}
+
+
+// An operation that has been submitted (or is waiting to be
+// submitted) to the io_uring of an event loop.
+struct Operation
+{
+  Operation(
+      int _fd,
+      uint64_t _tag,
+      const lambda::function<void(struct io_uring_sqe*)>& _prepare)
+    : fd(_fd), tag(_tag), prepare(_prepare) {}
+
+  const int fd;
+  const uint64_t tag;
+  const lambda::function<void(struct io_uring_sqe*)> prepare;
+
+  Promise<int> promise;
+
+  // Whether the operation has been handed a submission queue entry
+  // and whether its cancellation has been requested.
+  bool submitted = false;
+  bool cancelled = false;
+};
+
+
+// The io_uring of an event loop along with its outstanding
+// operations (see `EventLoopShard::uring`). Only ever accessed from
+// within the event loop.
+struct Loop
+{
+  Ring* ring = nullptr;
+
+  // Signaled by the kernel when completions are posted.
+  int eventfd = -1;
+  ev_io completions;
+
+  // Submits everything that was queued during an iteration of the
+  // event loop right before the event loop blocks.
+  ev_prepare submissions;
+
+  // Operations by their `user_data`, which is never `CANCELLATION`.
+  uint64_t next = CANCELLATION + 1;
+  hashmap<uint64_t, Operation*> operations;
+  hashmap<uint64_t, hashset<uint64_t>> tags;
+
+  // Operations and cancellations (by `user_data`) that are waiting
+  // for a submission queue entry.
+  std::deque<uint64_t> backlog;
+  std::deque<uint64_t> cancellations;
+};
+
+
+static std::atomic<bool> enabled_(false);
+static std::atomic<uint64_t> tags_(1);
+
+
+namespace internal {
+
+Operation* remove(Loop* loop, uint64_t id)
+{
+  Option<Operation*> operation = loop->operations.get(id);
+  if (operation.isNone()) {
+    return nullptr;
+  }
+
+  loop->operations.erase(id);
+
+  if (operation.get()->tag != 0) {
+    hashset<uint64_t>& ids = loop->tags[operation.get()->tag];
+    ids.erase(id);
+    if (ids.empty()) {
+      loop->tags.erase(operation.get()->tag);
+    }
+  }
+
+  return operation.get();
+}
+
+
+// Event loop callback before the event loop blocks.
+void flush(struct ev_loop* _, ev_prepare* watcher, int revents)
+{
+  Loop* loop = reinterpret_cast<Loop*>(watcher->data);
+
+  while (true) {
+    // Cancellations go first so they free up entries for the backlog.
+    while (!loop->cancellations.empty()) {
+      struct io_uring_sqe* sqe = loop->ring->sqe();
+      if (sqe == nullptr) {
+        break;
+      }
+
+      sqe->opcode = IORING_OP_ASYNC_CANCEL;
+      sqe->fd = -1;
+      sqe->addr = loop->cancellations.front();
+      sqe->user_data = CANCELLATION;
+
+      loop->cancellations.pop_front();
+    }
+
+    while (!loop->backlog.empty()) {
+      // Skip any operations that were discarded before they were
+      // submitted.
+      Option<Operation*> operation =
+        loop->operations.get(loop->backlog.front());
+
+      if (operation.isNone()) {
+        loop->backlog.pop_front();
+        continue;
+      }
+
+      struct io_uring_sqe* sqe = loop->ring->sqe();
+      if (sqe == nullptr) {
+        break;
+      }
+
+      operation.get()->prepare(sqe);
+      operation.get()->submitted = true;
+
+      sqe->user_data = loop->backlog.front();
+
+      loop->backlog.pop_front();
+    }
+
+    if (loop->ring->pending() == 0) {
+      break;
+    }
+
+    Try<Nothing> submit = loop->ring->submit();
+    if (submit.isError()) {
+      LOG(ERROR) << submit.error();
+      break;
+    }
+
+    // Try again with the entries the kernel just consumed, unless it
+    // didn't consume all of them (see `Ring::submit`) in which case
+    // we try again after reaping some completions.
+    if ((loop->backlog.empty() && loop->cancellations.empty()) ||
+        loop->ring->pending() > 0) {
+      break;
+    }
+  }
+}
+
+
+// Event loop callback when the kernel has posted completions.
+void reap(struct ev_loop* _, ev_io* watcher, int revents)
+{
+  Loop* loop = reinterpret_cast<Loop*>(watcher->data);
+
+  uint64_t count;
+  while (::read(loop->eventfd, &count, sizeof(count)) < 0 && errno == EINTR);
+
+  // Collect the completed operations first since completing their
+  // promises might submit further operations.
+  std::vector<std::pair<Operation*, int>> completed;
+
+  loop->ring->reap([&](const struct io_uring_cqe& cqe) {
+    if (cqe.user_data == CANCELLATION) {
+      return;
+    }
+
+    Operation* operation = remove(loop, cqe.user_data);
+    if (operation != nullptr) {
+      completed.emplace_back(operation, cqe.res);
+    }
+  });
+
+  foreach (auto& completion, completed) {
+    Operation* operation = completion.first;
+
+    // NOTE: An operation might complete before its cancellation got
+    // to it, in which case we still provide the result since data
+    // might have been transferred.
+    if (operation->cancelled && completion.second == -ECANCELED) {
+      operation->promise.discard();
+    } else {
+      operation->promise.set(completion.second);
+    }
+
+    delete operation;
+  }
+}
+
+
+void cancel(EventLoopShard* shard, uint64_t id)
+{
+  Loop* loop = shard->uring;
+  if (loop == nullptr) {
+    return;
+  }
+
+  Option<Operation*> operation = loop->operations.get(id);
+  if (operation.isNone() || operation.get()->cancelled) {
+    return;
+  }
+
+  // Operations that haven't been handed to the kernel yet can be
+  // discarded right away.
+  if (!operation.get()->submitted) {
+    remove(loop, id);
+    operation.get()->promise.discard();
+    delete operation.get();
+    return;
+  }
+
+  operation.get()->cancelled = true;
+  loop->cancellations.push_back(id);
+}
+
+
+Future<Nothing> _cancel(EventLoopShard* shard, uint64_t tag)
+{
+  Loop* loop = shard->uring;
+  if (loop == nullptr) {
+    return Nothing();
+  }
+
+  Option<hashset<uint64_t>> ids = loop->tags.get(tag);
+  if (ids.isSome()) {
+    foreach (uint64_t id, ids.get()) {
+      cancel(shard, id);
+    }
+  }
+
+  return Nothing();
+}
+
+
+// Helper/continuation of 'submit' on future discard.
+void discard(EventLoopShard* shard, uint64_t id)
+{
+  run_in_event_loop<Nothing>(shard, [=]() -> Future<Nothing> {
+    cancel(shard, id);
+    return Nothing();
+  });
+}
+
+
+Future<int> submit(
+    EventLoopShard* shard,
+    int fd,
+    const lambda::function<void(struct io_uring_sqe*)>& prepare,
+    uint64_t tag)
+{
+  Loop* loop = shard->uring;
+  if (loop == nullptr) {
+    return Failure("io_uring is not enabled");
+  }
+
+  const uint64_t id = loop->next++;
+
+  Operation* operation = new Operation(fd, tag, prepare);
+
+  loop->operations[id] = operation;
+
+  if (tag != 0) {
+    loop->tags[tag].insert(id);
+  }
+
+  // The operation gets its submission queue entry right before the
+  // event loop blocks, see `flush`.
+  loop->backlog.push_back(id);
+
+  Future<int> future = operation->promise.future();
+
+  future.onDiscard(lambda::bind(&discard, shard, id));
+
+  return future;
+}
+
+
+Try<Loop*> create(EventLoopShard* shard)
+{
+  Try<Ring*> ring = Ring::create(ENTRIES);
+  if (ring.isError()) {
+    return Error(ring.error());
+  }
+
+  int eventfd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  if (eventfd < 0) {
+    ErrnoError error("Failed to create eventfd");
+    delete ring.get();
+    return error;
+  }
+
+  Try<Nothing> registered = ring.get()->registerEventfd(eventfd);
+  if (registered.isError()) {
+    os::close(eventfd);
+    delete ring.get();
+    return Error(registered.error());
+  }
+
+  Loop* loop = new Loop();
+  loop->ring = ring.get();
+  loop->eventfd = eventfd;
+
+  ev_io_init(&loop->completions, reap, eventfd, EV_READ);
+  ev_prepare_init(&loop->submissions, flush);
+
+  loop->completions.data = loop;
+  loop->submissions.data = loop;
+
+  ev_io_start(shard->loop, &loop->completions);
+  ev_prepare_start(shard->loop, &loop->submissions);
+
+  return loop;
+}
+
+
+void destroy(EventLoopShard* shard)
+{
+  Loop* loop = shard->uring;
+
+  ev_io_stop(shard->loop, &loop->completions);
+  ev_prepare_stop(shard->loop, &loop->submissions);
+
+  delete loop->ring;
+  os::close(loop->eventfd);
+
+  foreachvalue (Operation* operation, loop->operations) {
+    delete operation;
+  }
+
+  delete loop;
+
+  shard->uring = nullptr;
+}
+
+} // namespace internal {
+
+
+void initialize(bool enable)
+{
+  CHECK(!enabled_.load());
+
+  if (!enable) {
+    return;
+  }
+
+  foreach (EventLoopShard* shard, *shards) {
+    Try<Loop*> loop = internal::create(shard);
+    if (loop.isError()) {
+      LOG(WARNING) << "Falling back to poll since io_uring is unavailable: "
+                   << loop.error();
+      finalize();
+      return;
+    }
+
+    shard->uring = loop.get();
+  }
+
+  VLOG(1) << "Using io_uring for the I/O of " << shards->size()
+          << " event loop(s)";
+
+  enabled_.store(true);
+}
+
+
+void finalize()
+{
+  enabled_.store(false);
+
+  foreach (EventLoopShard* shard, *shards) {
+    if (shard->uring != nullptr) {
+      internal::destroy(shard);
+    }
+  }
+}
+
+
+bool enabled()
+{
+  return enabled_.load();
+}
+
+
+uint64_t tag()
+{
+  return tags_.fetch_add(1);
+}
+
+
+Future<int> submit(
+    int fd,
+    const lambda::function<void(struct io_uring_sqe*)>& prepare,
+    uint64_t tag)
+{
+  // Operations on a file descriptor are submitted by the event loop
+  // that is responsible for it (see `shard()` in libev.hpp).
+  EventLoopShard* shard = process::shard(fd);
+
+  return run_in_event_loop<int>(
+      shard,
+      lambda::bind(&internal::submit, shard, fd, prepare, tag));
+}
+
+
+void cancel(int fd, uint64_t tag)
+{
+  EventLoopShard* shard = process::shard(fd);
+
+  run_in_event_loop<Nothing>(
+      shard,
+      lambda::bind(&internal::_cancel, shard, tag));
+}
+
+
+Future<short> poll(int fd, short events, uint64_t tag)
+{
+  uint32_t mask = 0;
+
+  if ((events & io::READ) != 0) {
+    mask |= POLLIN;
+  }
+
+  if ((events & io::WRITE) != 0) {
+    mask |= POLLOUT;
+  }
+
+#if __BYTE_ORDER == __BIG_ENDIAN
+  // The kernel expects the mask in the halfword order of `poll_events`.
+  mask = (mask << 16) | (mask >> 16);
+#endif
+
+  return submit(
+      fd,
+      [=](struct io_uring_sqe* sqe) {
+        sqe->opcode = IORING_OP_POLL_ADD;
+        sqe->fd = fd;
+        sqe->poll32_events = mask;
+      },
+      tag)
+    .then([=](int result) -> Future<short> {
+      if (result < 0) {
+        return Failure("Failed to poll: " + os::strerror(-result));
+      }
+
+      // Like libev we report errors and hang ups as the requested
+      // events so that the subsequent I/O surfaces them.
+      short polled = 0;
+
+      if ((events & io::READ) != 0 &&
+          (result & (POLLIN | POLLERR | POLLHUP)) != 0) {
+        polled |= io::READ;
+      }
+
+      if ((events & io::WRITE) != 0 &&
+          (result & (POLLOUT | POLLERR | POLLHUP)) != 0) {
+        polled |= io::WRITE;
+      }
+
+      return polled != 0 ? polled : events;
+    });
+}
+
+} // namespace io_uring {
+} // namespace process {
@@ -0,0 +1,172 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#ifndef __IO_URING_HPP__
+#define __IO_URING_HPP__
+
+#include <linux/io_uring.h>
+
+// NOTE: <linux/io_uring.h> pulls in <linux/fs.h> which defines
+// `BLOCK_SIZE`, a name that the lock-free run queue (concurrentqueue)
+// uses for its own constants.
+#undef BLOCK_SIZE
+#undef BLOCK_SIZE_BITS
+
+#include <stdint.h>
+
+#include <process/future.hpp>
+
+#include <stout/lambda.hpp>
+#include <stout/nothing.hpp>
+#include <stout/try.hpp>
+
+namespace process {
+namespace io_uring {
+
+// Sets up an io_uring instance for each event loop if `enable` is
+// true (see `LIBPROCESS_ENABLE_IO_URING`). If the kernel does not
+// support io_uring (or some of the features we rely on) a warning is
+// logged and all I/O keeps being done with poll. Must be called while
+// none of the event loops are running.
+void initialize(bool enable);
+
+
+// Tears down the io_uring instances of all event loops, leaving any
+// outstanding operations pending. Must be called while none of the
+// event loops are running.
+void finalize();
+
+
+// Returns true if I/O is done with io_uring.
+bool enabled();
+
+
+// Returns a new tag for grouping operations (see `cancel`).
+uint64_t tag();
+
+
+// Submits an operation on the file descriptor to the io_uring of the
+// event loop that is responsible for the file descriptor (see
+// `shard()` in libev.hpp). The `prepare` function fills in the
+// submission queue entry (everything but its `user_data`) and is kept
+// until the operation completes, so it should also keep alive any
+// memory the operation refers to.
+//
+// Submissions are batched: all operations that are submitted during
+// one iteration of an event loop are handed to the kernel with a
+// single system call right before the event loop blocks.
+//
+// Returns the result of the operation, i.e., a negative errno value
+// if the operation failed. Discarding the returned future cancels
+// the operation, it is only discarded once the kernel is done with
+// the operation.
+Future<int> submit(
+    int fd,
+    const lambda::function<void(struct io_uring_sqe*)>& prepare,
+    uint64_t tag = 0);
+
+
+// Cancels all outstanding operations with the specified tag, e.g.,
+// before closing the file descriptor they were submitted for (the
+// kernel holds a reference to the file while an operation is in
+// progress, so closing it would not interrupt the operation).
+void cancel(int fd, uint64_t tag);
+
+
+// Polls the file descriptor for the `io::READ` and/or `io::WRITE`
+// events using `IORING_OP_POLL_ADD`, see `io::poll`.
+Future<short> poll(int fd, short events, uint64_t tag = 0);
+
+
+// A submission and completion queue pair shared with the kernel, see
+// io_uring_setup(2). A ring is only used by a single event loop
+// thread so none of its functions are thread-safe.
+class Ring
+{
+public:
+  // Returns an error if the kernel does not support io_uring or any
+  // of the features we rely on.
+  static Try<Ring*> create(unsigned entries);
+
+  ~Ring();
+
+  // Returns an unused submission queue entry that will be submitted
+  // by the next call to `submit`, or `nullptr` if the submission
+  // queue is full.
+  struct io_uring_sqe* sqe();
+
+  // Returns the number of entries that have not yet been consumed by
+  // the kernel.
+  unsigned pending() const;
+
+  // Hands all the pending entries to the kernel.
+  Try<Nothing> submit();
+
+  // Invokes the function for each available completion.
+  template <typename F>
+  void reap(F&& f)
+  {
+    unsigned head = *cq.head;
+    const unsigned tail = __atomic_load_n(cq.tail, __ATOMIC_ACQUIRE);
+
+    while (head != tail) {
+      f(cq.cqes[head & *cq.mask]);
+      head++;
+    }
+
+    __atomic_store_n(cq.head, head, __ATOMIC_RELEASE);
+  }
+
+  // Have the kernel signal the eventfd whenever completions are
+  // posted.
+  Try<Nothing> registerEventfd(int eventfd);
+
+private:
+  Ring() = default;
+  Ring(const Ring&) = delete;
+  Ring& operator=(const Ring&) = delete;
+
+  int fd = -1;
+
+  struct
+  {
+    void* ring = nullptr;
+    size_t size = 0;
+    unsigned* head = nullptr;
+    unsigned* tail = nullptr;
+    unsigned* mask = nullptr;
+    unsigned* array = nullptr;
+    unsigned entries = 0;
+
+    // The tail including the entries that have been handed out by
+    // `sqe` but not yet been made visible to the kernel.
+    unsigned local = 0;
+
+    struct io_uring_sqe* sqes = nullptr;
+    size_t sqesSize = 0;
+  } sq;
+
+  struct
+  {
+    void* ring = nullptr;
+    size_t size = 0;
+    unsigned* head = nullptr;
+    unsigned* tail = nullptr;
+    unsigned* mask = nullptr;
+    struct io_uring_cqe* cqes = nullptr;
+  } cq;
+};
+
+} // namespace io_uring {
+} // namespace process {
+
+#endif // __IO_URING_HPP__
@@ -0,0 +1,204 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#include <limits.h>
+
+#include <sys/socket.h>
+#include <sys/uio.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include <process/io.hpp>
+#include <process/network.hpp>
+#include <process/socket.hpp>
+
+#include <stout/lambda.hpp>
+#include <stout/os/strerror.hpp>
+
+#include "io_uring.hpp"
+#include "io_uring_socket.hpp"
+
+using std::pair;
+using std::vector;
+
+namespace process {
+namespace network {
+namespace internal {
+
+Try<std::shared_ptr<SocketImpl>> IoUringSocketImpl::create(int_fd s)
+{
+  return std::make_shared<IoUringSocketImpl>(s);
+}
+
+
+IoUringSocketImpl::IoUringSocketImpl(int_fd s)
+  : PollSocketImpl(s), tag(io_uring::tag()) {}
+
+
+IoUringSocketImpl::~IoUringSocketImpl()
+{
+  // The kernel holds a reference to the socket while an operation is
+  // in progress, so we need to cancel them for the socket to actually
+  // get closed (rather than when the peer eventually sends something).
+  if (get() >= 0) {
+    io_uring::cancel(get(), tag);
+  }
+}
+
+
+namespace internal {
+
+// The largest transfer we ask for since the result is an `int`.
+constexpr size_t MAX_LENGTH = INT_MAX;
+
+
+Future<size_t> socket_recv(int_fd s, uint64_t tag, char* data, size_t size)
+{
+  return io_uring::submit(
+      s,
+      [=](struct io_uring_sqe* sqe) {
+        sqe->opcode = IORING_OP_RECV;
+        sqe->fd = s;
+        sqe->addr = reinterpret_cast<uint64_t>(data);
+        sqe->len = static_cast<uint32_t>(std::min(size, MAX_LENGTH));
+      },
+      tag)
+    .then([=](int result) -> Future<size_t> {
+      if (result < 0 && net::is_restartable_error(-result)) {
+        // Interrupted, try again now.
+        return socket_recv(s, tag, data, size);
+      } else if (result < 0 && net::is_retryable_error(-result)) {
+        // Some kernels honor `O_NONBLOCK` rather than waiting for the
+        // socket to become readable, so we wait for it ourselves.
+        return io_uring::poll(s, io::READ, tag)
+          .then(lambda::bind(&socket_recv, s, tag, data, size));
+      } else if (result < 0) {
+        return Failure(os::strerror(-result));
+      }
+
+      return static_cast<size_t>(result);
+    });
+}
+
+
+Future<size_t> socket_send(
+    const std::shared_ptr<SocketImpl>& impl,
+    uint64_t tag,
+    const lambda::function<void(struct io_uring_sqe*)>& prepare)
+{
+  return io_uring::submit(impl->get(), prepare, tag)
+    .then([=](int result) -> Future<size_t> {
+      if (result < 0 && net::is_restartable_error(-result)) {
+        // Interrupted, try again now.
+        return socket_send(impl, tag, prepare);
+      } else if (result < 0 && net::is_retryable_error(-result)) {
+        // Might block, try again later.
+        return io_uring::poll(impl->get(), io::WRITE, tag)
+          .then(lambda::bind(&socket_send, impl, tag, prepare));
+      } else if (result < 0) {
+        const std::string error = os::strerror(-result);
+        VLOG(1) << "Socket error while sending: " << error;
+        return Failure("Socket send failed: " + error);
+      } else if (result == 0) {
+        VLOG(1) << "Socket closed while sending";
+      }
+
+      return static_cast<size_t>(result);
+    });
+}
+
+} // namespace internal {
+
+
+Future<size_t> IoUringSocketImpl::recv(char* data, size_t size)
+{
+  // Like `io::read`, which is used by a `PollSocketImpl`.
+  if (size == 0) {
+    return 0;
+  }
+
+  // NOTE: Just like for a `PollSocketImpl` a pending receive does not
+  // keep the socket alive, the destructor cancels it instead.
+  return internal::socket_recv(get(), tag, data, size);
+}
+
+
+Future<size_t> IoUringSocketImpl::send(const char* data, size_t size)
+{
+  CHECK(size > 0);
+
+  const int_fd s = get();
+
+  return internal::socket_send(
+      shared(this),
+      tag,
+      [=](struct io_uring_sqe* sqe) {
+        sqe->opcode = IORING_OP_SEND;
+        sqe->fd = s;
+        sqe->addr = reinterpret_cast<uint64_t>(data);
+        sqe->len = static_cast<uint32_t>(std::min(size, internal::MAX_LENGTH));
+        sqe->msg_flags = MSG_NOSIGNAL;
+      });
+}
+
+
+Future<size_t> IoUringSocketImpl::send(
+    const vector<pair<const char*, size_t>>& buffers)
+{
+  CHECK(!buffers.empty());
+
+  // The message needs to stay around until the kernel is done with
+  // it, which the function preparing the submission takes care of.
+  struct Message
+  {
+    vector<struct iovec> iov;
+    struct msghdr header;
+  };
+
+  std::shared_ptr<Message> message(new Message());
+
+  // Any buffers beyond `IOV_MAX` are left for the caller to send
+  // with a subsequent call, just like any other partial send.
+  message->iov.resize(std::min(buffers.size(), static_cast<size_t>(IOV_MAX)));
+  for (size_t i = 0; i < message->iov.size(); i++) {
+    CHECK(buffers[i].second > 0);
+    message->iov[i].iov_base = const_cast<char*>(buffers[i].first);
+    message->iov[i].iov_len = buffers[i].second;
+  }
+
+  message->header = {};
+  message->header.msg_iov = message->iov.data();
+  message->header.msg_iovlen = message->iov.size();
+
+  const int_fd s = get();
+
+  return internal::socket_send(
+      shared(this),
+      tag,
+      [=](struct io_uring_sqe* sqe) {
+        sqe->opcode = IORING_OP_SENDMSG;
+        sqe->fd = s;
+        sqe->addr = reinterpret_cast<uint64_t>(&message->header);
+        sqe->len = 1;
+        sqe->msg_flags = MSG_NOSIGNAL;
+      });
+}
+
+} // namespace internal {
+} // namespace network {
+} // namespace process {
@@ -0,0 +1,63 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#ifndef __IO_URING_SOCKET_HPP__
+#define __IO_URING_SOCKET_HPP__
+
+#include <stdint.h>
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <process/future.hpp>
+#include <process/socket.hpp>
+
+#include <stout/try.hpp>
+
+#include "poll_socket.hpp"
+
+namespace process {
+namespace network {
+namespace internal {
+
+// A socket that sends and receives with io_uring rather than waiting
+// for readiness and then doing the I/O itself, used in place of a
+// `PollSocketImpl` when `LIBPROCESS_ENABLE_IO_URING` is set (see
+// io_uring.hpp). Listening, accepting, connecting and sending files
+// is still done like for a `PollSocketImpl`.
+class IoUringSocketImpl : public PollSocketImpl
+{
+public:
+  static Try<std::shared_ptr<SocketImpl>> create(int_fd s);
+
+  IoUringSocketImpl(int_fd s);
+
+  virtual ~IoUringSocketImpl();
+
+  // Implementation of the SocketImpl interface.
+  virtual Future<size_t> recv(char* data, size_t size);
+  virtual Future<size_t> send(const char* data, size_t size);
+  virtual Future<size_t> send(
+      const std::vector<std::pair<const char*, size_t>>& buffers);
+
+private:
+  // Tags the operations of this socket so that they can be cancelled
+  // when the socket gets closed.
+  const uint64_t tag;
+};
+
+} // namespace internal {
+} // namespace network {
+} // namespace process {
+
+#endif // __IO_URING_SOCKET_HPP__
@@ -14,8 +14,12 @@
 
 #include <mutex>
 #include <queue>
+#include <vector>
+
+#include <glog/logging.h>
 
 #include <stout/duration.hpp>
+#include <stout/foreach.hpp>
 #include <stout/lambda.hpp>
 #include <stout/nothing.hpp>
 
@@ -24,47 +28,29 @@
 
 namespace process {
 
-ev_async async_watcher;
-// We need an asynchronous watcher to receive the request to shutdown.
-ev_async shutdown_watcher;
-
-// Define the initial values for all of the declarations made in
-// libev.hpp (since these need to live in the static data space).
-struct ev_loop* loop = nullptr;
-
-std::queue<ev_io*>* watchers = new std::queue<ev_io*>();
+std::vector<EventLoopShard*>* shards = new std::vector<EventLoopShard*>();
 
-std::mutex* watchers_mutex = new std::mutex();
+thread_local EventLoopShard* _event_loop_shard_ = nullptr;
 
-std::queue<lambda::function<void()>>* functions =
-  new std::queue<lambda::function<void()>>();
 
-thread_local bool* _in_event_loop_ = nullptr;
-
-
-void handle_async(struct ev_loop* loop, ev_async* _, int revents)
+void handle_async(struct ev_loop* loop, ev_async* watcher, int revents)
 {
-  std::queue<lambda::function<void()>> run_functions;
-  synchronized (watchers_mutex) {
-    // Start all the new I/O watchers.
-    while (!watchers->empty()) {
-      ev_io* watcher = watchers->front();
-      watchers->pop();
-      ev_io_start(loop, watcher);
-    }
+  EventLoopShard* shard = reinterpret_cast<EventLoopShard*>(watcher->data);
 
+  std::queue<lambda::function<void()>> run_functions;
+  synchronized (shard->functions_mutex) {
     // Swap the functions into a temporary queue so that we can invoke
     // them outside of the mutex.
-    std::swap(run_functions, *functions);
+    std::swap(run_functions, shard->functions);
   }
 
   // Running the functions outside of the mutex reduces locking
   // contention as these are arbitrary functions that can take a long
   // time to execute. Doing this also avoids a deadlock scenario where
   // (A) mutexes are acquired before calling `run_in_event_loop`,
-  // followed by locking (B) `watchers_mutex`. If we executed the
+  // followed by locking (B) `functions_mutex`. If we executed the
   // functions inside the mutex, then the locking order violation
-  // would be this function acquiring the (B) `watchers_mutex`
+  // would be this function acquiring the (B) `functions_mutex`
   // followed by the arbitrary function acquiring the (A) mutexes.
   while (!run_functions.empty()) {
     (run_functions.front())();
@@ -79,15 +65,50 @@ void handle_shutdown(struct ev_loop* loop, ev_async* _, int revents)
 }
 
 
-void EventLoop::initialize()
+void EventLoop::initialize(size_t loops)
 {
-  loop = ev_default_loop(EVFLAG_AUTO);
+  CHECK_GT(loops, 0u);
+
+  // NOTE: libprocess can get reinitialized (e.g., in tests) with a
+  // different number of event loops. At this point none of the event
+  // loop threads are running, so we can safely destroy any loops we
+  // no longer need.
+  while (shards->size() > loops) {
+    EventLoopShard* shard = shards->back();
+    shards->pop_back();
+    ev_loop_destroy(shard->loop);
+    delete shard;
+  }
 
-  ev_async_init(&async_watcher, handle_async);
-  ev_async_init(&shutdown_watcher, handle_shutdown);
+  while (shards->size() < loops) {
+    EventLoopShard* shard = new EventLoopShard();
+
+    // The first loop is the libev default loop, every other loop is
+    // created separately so it can be run by its own thread.
+    shard->loop = shards->empty()
+      ? ev_default_loop(EVFLAG_AUTO)
+      : ev_loop_new(EVFLAG_AUTO);
+
+    if (shard->loop == nullptr) {
+      LOG(FATAL) << "Failed to initialize event loop " << shards->size();
+    }
 
-  ev_async_start(loop, &async_watcher);
-  ev_async_start(loop, &shutdown_watcher);
+    ev_async_init(&shard->async_watcher, handle_async);
+    ev_async_init(&shard->shutdown_watcher, handle_shutdown);
+
+    shard->async_watcher.data = shard;
+
+    ev_async_start(shard->loop, &shard->async_watcher);
+    ev_async_start(shard->loop, &shard->shutdown_watcher);
+
+    shards->push_back(shard);
+  }
+}
+
+
+size_t EventLoop::loops()
+{
+  return shards->size();
 }
 
 
@@ -124,7 +145,7 @@ Future<Nothing> delay(
   const double repeat = 0.0;
 
   ev_timer_init(timer, handle_delay, after, repeat);
-  ev_timer_start(loop, timer);
+  ev_timer_start(shards->front()->loop, timer);
 
   return Nothing();
 }
@@ -148,19 +169,25 @@ double EventLoop::time()
 }
 
 
-void EventLoop::run()
+void EventLoop::run(size_t index)
 {
-  __in_event_loop__ = true;
+  CHECK_LT(index, shards->size());
+
+  EventLoopShard* shard = (*shards)[index];
 
-  ev_loop(loop, 0);
+  _event_loop_shard_ = shard;
 
-  __in_event_loop__ = false;
+  ev_loop(shard->loop, 0);
+
+  _event_loop_shard_ = nullptr;
 }
 
 
 void EventLoop::stop()
 {
-  ev_async_send(loop, &shutdown_watcher);
+  foreach (EventLoopShard* shard, *shards) {
+    ev_async_send(shard->loop, &shard->shutdown_watcher);
+  }
 }
 
 } // namespace process {
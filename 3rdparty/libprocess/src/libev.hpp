@@ -17,6 +17,9 @@
 
 #include <mutex>
 #include <queue>
+#include <vector>
+
+#include <glog/logging.h>
 
 #include <process/future.hpp>
 #include <process/owned.hpp>
@@ -26,33 +29,62 @@
 
 namespace process {
 
-// Event loop.
-extern struct ev_loop* loop;
+#ifdef USE_IO_URING
+namespace io_uring {
+
+// Forward declaration.
+struct Loop;
+
+} // namespace io_uring {
+#endif // USE_IO_URING
+
+
+// An event loop along with the watchers used to interrupt it and the
+// functions that have been queued to run within it.
+//
+// There is one `EventLoopShard` per event loop thread. When more than
+// one event loop is run (see `LIBPROCESS_NUM_EVENT_LOOPS`) every file
+// descriptor is assigned to exactly one shard so that all I/O on a
+// socket is performed by the same event loop thread.
+struct EventLoopShard
+{
+  struct ev_loop* loop = nullptr;
+
+  ev_async async_watcher;
+  ev_async shutdown_watcher;
 
-// Asynchronous watcher for interrupting loop to specifically deal
-// with IO watchers and functions (via run_in_event_loop).
-extern ev_async async_watcher;
+  std::mutex functions_mutex;
+  std::queue<lambda::function<void()>> functions;
 
-// Queue of I/O watchers to be asynchronously added to the event loop
-// (protected by 'watchers' below).
-// TODO(benh): Replace this queue with functions that we put in
-// 'functions' below that perform the ev_io_start themselves.
-extern std::queue<ev_io*>* watchers;
-extern std::mutex* watchers_mutex;
+#ifdef USE_IO_URING
+  // The io_uring used by this event loop, or `nullptr` if I/O is
+  // done with poll (see io_uring.hpp).
+  io_uring::Loop* uring = nullptr;
+#endif // USE_IO_URING
+};
 
-// Queue of functions to be invoked asynchronously within the vent
-// loop (protected by 'watchers' above).
-extern std::queue<lambda::function<void()>>* functions;
 
-// Per thread bool pointer. We use a pointer to lazily construct the
-// actual bool.
-extern thread_local bool* _in_event_loop_;
+// All of the event loops. The first shard wraps the libev default
+// loop, which is also the loop used for timers (see
+// `EventLoop::delay`).
+extern std::vector<EventLoopShard*>* shards;
 
-#define __in_event_loop__ *(_in_event_loop_ == nullptr ?                \
-  _in_event_loop_ = new bool(false) : _in_event_loop_)
+// The shard being run by the current thread, or `nullptr` if the
+// current thread is not an event loop thread.
+extern thread_local EventLoopShard* _event_loop_shard_;
+
+
+// Returns the shard that is responsible for polling the specified
+// file descriptor. The assignment is stable for as long as the file
+// descriptor is open, i.e., from the time a socket is accepted or
+// created until it gets closed.
+inline EventLoopShard* shard(int fd)
+{
+  CHECK(!shards->empty());
+  return (*shards)[static_cast<size_t>(fd) % shards->size()];
+}
 
 
-// Wrapper around function we want to run in the event loop.
 template <typename T>
 void _run_in_event_loop(
     const lambda::function<Future<T>()>& f,
@@ -67,12 +99,13 @@ void _run_in_event_loop(
 }
 
 
-// Helper for running a function in the event loop.
 template <typename T>
-Future<T> run_in_event_loop(const lambda::function<Future<T>()>& f)
+Future<T> run_in_event_loop(
+    EventLoopShard* shard,
+    const lambda::function<Future<T>()>& f)
 {
-  // If this is already the event loop then just run the function.
-  if (__in_event_loop__) {
+  // If this is already the right event loop then just run the function.
+  if (_event_loop_shard_ == shard) {
     return f();
   }
 
@@ -81,16 +114,24 @@ Future<T> run_in_event_loop(const lambda::function<Future<T>()>& f)
   Future<T> future = promise->future();
 
   // Enqueue the function.
-  synchronized (watchers_mutex) {
-    functions->push(lambda::bind(&_run_in_event_loop<T>, f, promise));
+  synchronized (shard->functions_mutex) {
+    shard->functions.push(lambda::bind(&_run_in_event_loop<T>, f, promise));
   }
 
   // Interrupt the loop.
-  ev_async_send(loop, &async_watcher);
+  ev_async_send(shard->loop, &shard->async_watcher);
 
   return future;
 }
 
+
+// Runs the function in the default event loop.
+template <typename T>
+Future<T> run_in_event_loop(const lambda::function<Future<T>()>& f)
+{
+  return run_in_event_loop<T>(shards->front(), f);
+}
+
 } // namespace process {
 
 #endif // __LIBEV_HPP__
@@ -19,6 +19,9 @@
 
 #include <stout/lambda.hpp>
 
+#ifdef USE_IO_URING
+#include "io_uring.hpp"
+#endif
 #include "libev.hpp"
 
 namespace process {
@@ -90,13 +93,13 @@ namespace io {
 namespace internal {
 
 // Helper/continuation of 'poll' on future discard.
-void _poll(const std::shared_ptr<ev_async>& async)
+void _poll(EventLoopShard* shard, const std::shared_ptr<ev_async>& async)
 {
-  ev_async_send(loop, async.get());
+  ev_async_send(shard->loop, async.get());
 }
 
 
-Future<short> poll(int_fd fd, short events)
+Future<short> poll(EventLoopShard* shard, int_fd fd, short events)
 {
   Poll* poll = new Poll();
 
@@ -109,7 +112,7 @@ Future<short> poll(int_fd fd, short events)
 
   // Initialize and start the async watcher.
   ev_async_init(poll->watcher.async.get(), discard_poll);
-  ev_async_start(loop, poll->watcher.async.get());
+  ev_async_start(shard->loop, poll->watcher.async.get());
 
   // Make sure we stop polling if a discard occurs on our future.
   // Note that it's possible that we'll invoke '_poll' when someone
@@ -117,11 +120,11 @@ Future<short> poll(int_fd fd, short events)
   // in this case while we will interrupt the event loop since the
   // async watcher has already been stopped we won't cause
   // 'discard_poll' to get invoked.
-  future.onDiscard(lambda::bind(&_poll, poll->watcher.async));
+  future.onDiscard(lambda::bind(&_poll, shard, poll->watcher.async));
 
   // Initialize and start the I/O watcher.
   ev_io_init(poll->watcher.io.get(), polled, fd, events);
-  ev_io_start(loop, poll->watcher.io.get());
+  ev_io_start(shard->loop, poll->watcher.io.get());
 
   return future;
 }
@@ -135,7 +138,19 @@ Future<short> poll(int_fd fd, short events)
 
   // TODO(benh): Check if the file descriptor is non-blocking?
 
-  return run_in_event_loop<short>(lambda::bind(&internal::poll, fd, events));
+#ifdef USE_IO_URING
+  if (io_uring::enabled()) {
+    return io_uring::poll(fd, events);
+  }
+#endif // USE_IO_URING
+
+  // All polling for a file descriptor happens in the same event loop
+  // (see `shard()` in libev.hpp).
+  EventLoopShard* shard = process::shard(fd);
+
+  return run_in_event_loop<short>(
+      shard,
+      lambda::bind(&internal::poll, shard, fd, events));
 }
 
 } // namespace io {
@@ -90,8 +90,10 @@ void run_in_event_loop(
 }
 
 
-void EventLoop::run()
+void EventLoop::run(size_t loop)
 {
+  CHECK_EQ(0u, loop);
+
   __in_event_loop__ = true;
 
   do {
@@ -177,8 +179,14 @@ double EventLoop::time()
 }
 
 
-void EventLoop::initialize()
+void EventLoop::initialize(size_t loops)
 {
+  if (loops > 1) {
+    LOG(WARNING) << "The libevent event loop does not support sharding "
+                 << "sockets across multiple event loops, ignoring the "
+                 << "request for " << loops << " event loops";
+  }
+
   static Once* initialized = new Once();
 
   if (initialized->once()) {
@@ -217,4 +225,10 @@ void EventLoop::initialize()
   initialized->done();
 }
 
+
+size_t EventLoop::loops()
+{
+  return 1;
+}
+
 } // namespace process {
@@ -26,6 +26,7 @@
 #include <process/ssl/flags.hpp>
 
 #include <stout/net.hpp>
+#include <stout/stringify.hpp>
 #include <stout/synchronized.hpp>
 
 #include <stout/os/close.hpp>
@@ -136,6 +137,15 @@ LibeventSSLSocketImpl::~LibeventSSLSocketImpl()
           bufferevent_disable(_bev, EV_READ | EV_WRITE);
 
           SSL* ssl = bufferevent_openssl_get_ssl(_bev);
+
+          // Mark the connection as shut down (without sending a
+          // 'close_notify'), otherwise OpenSSL considers the session
+          // broken when freeing 'ssl' and it could no longer be
+          // resumed. Since TLS v1.1 sessions of connections that were
+          // not closed properly may still be resumed.
+          SSL_set_quiet_shutdown(ssl, 1);
+          SSL_shutdown(ssl);
+
           SSL_free(ssl);
           bufferevent_free(_bev);
         }
@@ -515,6 +525,10 @@ Future<Nothing> LibeventSSLSocketImpl::connect(const Address& address)
     return Failure("Failed to connect: SSL_new");
   }
 
+  // Offer the session last negotiated with this peer, if any, so
+  // that reconnects can skip the full handshake.
+  openssl::resume(ssl, stringify(address));
+
   // Construct the bufferevent in the connecting state.
   // We set 'BEV_OPT_DEFER_CALLBACKS' to avoid calling the
   // 'event_callback' before 'bufferevent_socket_connect' returns.
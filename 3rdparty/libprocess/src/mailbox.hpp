@@ -0,0 +1,229 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#ifndef __PROCESS_MAILBOX_HPP__
+#define __PROCESS_MAILBOX_HPP__
+
+#include <stdint.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include <process/future.hpp>
+#include <process/process.hpp>
+
+#include <stout/hashmap.hpp>
+#include <stout/nothing.hpp>
+#include <stout/option.hpp>
+#include <stout/synchronized.hpp>
+#include <stout/unreachable.hpp>
+
+namespace process {
+
+// The limit on the number of messages in the event queue of a process
+// (see `ProcessBase::limit`) and how the messages that overflow it are
+// handled.
+//
+// The size of the mailbox is updated by the producers and the (single)
+// consumer of the event queue. Producers reserve a slot _before_
+// enqueueing a message, only if there is one left, so that concurrent
+// producers can not overshoot the capacity (except for messages that
+// apply backpressure, which are always enqueued).
+class Mailbox
+{
+public:
+  typedef ProcessBase::Overflow Overflow;
+
+  Mailbox(size_t _capacity, Overflow _overflow)
+    : capacity(static_cast<int64_t>(_capacity)),
+      overflow(_overflow) {}
+
+  // NOTE: only invoked before the process is spawned, after which the
+  // policies are only read.
+  void policy(const std::string& name, Overflow overflow)
+  {
+    policies[name] = overflow;
+  }
+
+  Overflow policy(const std::string& name) const
+  {
+    if (!policies.empty()) {
+      hashmap<std::string, Overflow>::const_iterator iterator =
+        policies.find(name);
+
+      if (iterator != policies.end()) {
+        return iterator->second;
+      }
+    }
+
+    return overflow;
+  }
+
+  // Invoked by a producer before enqueueing a message with the given
+  // name. Returns `None` if the message should be enqueued, otherwise
+  // the overflow policy to apply instead (`DROP` or `REJECT`).
+  //
+  // If the message is enqueued although the mailbox is full (i.e., it
+  // applies backpressure) and 'backpressure' is not null, the future
+  // it is set to becomes ready once the mailbox has room again.
+  Option<Overflow> admit(
+      const std::string& name,
+      Option<Future<Nothing>>* backpressure)
+  {
+    // NOTE: we only increment the size while it is below the capacity,
+    // so producers whose messages get dropped or rejected never push it
+    // over the capacity (not even momentarily), which would otherwise
+    // cause concurrent messages to be dropped or rejected spuriously.
+    int64_t current = size.load();
+    while (current < capacity) {
+      if (size.compare_exchange_weak(current, current + 1)) {
+        return None();
+      }
+    }
+
+    const Overflow overflow = policy(name);
+
+    switch (overflow) {
+      case Overflow::DROP:
+        drops.fetch_add(1, std::memory_order_relaxed);
+        return overflow;
+      case Overflow::REJECT:
+        rejects.fetch_add(1, std::memory_order_relaxed);
+        return overflow;
+      case Overflow::BACKPRESSURE:
+        size.fetch_add(1);
+        overflows.fetch_add(1, std::memory_order_relaxed);
+
+        if (backpressure != nullptr) {
+          *backpressure = room();
+        }
+
+        return None();
+    }
+
+    UNREACHABLE();
+  }
+
+  // Invoked by the consumer after dequeueing a message.
+  void dequeued()
+  {
+    if (size.fetch_sub(1) <= capacity && waiting.load()) {
+      notify();
+    }
+  }
+
+  // Invoked when the process gets cleaned up, to not hold back the
+  // connections waiting for room in the mailbox forever.
+  void close()
+  {
+    std::shared_ptr<Promise<Nothing>> promise;
+
+    synchronized (mutex) {
+      promise.swap(this->promise);
+      waiting.store(false);
+    }
+
+    if (promise) {
+      promise->set(Nothing());
+    }
+  }
+
+  size_t limit() const
+  {
+    return static_cast<size_t>(capacity);
+  }
+
+  // The number of messages in the mailbox.
+  int64_t messages() const
+  {
+    return size.load(std::memory_order_relaxed);
+  }
+
+  uint64_t dropped() const
+  {
+    return drops.load(std::memory_order_relaxed);
+  }
+
+  uint64_t rejected() const
+  {
+    return rejects.load(std::memory_order_relaxed);
+  }
+
+  // The number of messages that were enqueued while the mailbox was
+  // full, i.e., that caused backpressure to be applied.
+  uint64_t backpressured() const
+  {
+    return overflows.load(std::memory_order_relaxed);
+  }
+
+private:
+  // Returns a future that becomes ready once the mailbox has room.
+  Future<Nothing> room()
+  {
+    synchronized (mutex) {
+      // NOTE: we set `waiting` _before_ checking the size again (both
+      // sequentially consistent) and the consumer decrements the size
+      // _before_ checking `waiting`, so either we see the room or the
+      // consumer sees us waiting.
+      waiting.store(true);
+
+      if (size.load() >= capacity) {
+        if (!promise) {
+          promise.reset(new Promise<Nothing>());
+        }
+
+        return promise->future();
+      }
+    }
+
+    return Nothing();
+  }
+
+  void notify()
+  {
+    std::shared_ptr<Promise<Nothing>> promise;
+
+    synchronized (mutex) {
+      if (size.load() >= capacity) {
+        return;
+      }
+
+      promise.swap(this->promise);
+      waiting.store(false);
+    }
+
+    // NOTE: we complete the promise outside of the critical section
+    // since its callbacks start reading from the connections again.
+    if (promise) {
+      promise->set(Nothing());
+    }
+  }
+
+  const int64_t capacity;
+  const Overflow overflow;
+  hashmap<std::string, Overflow> policies;
+
+  std::atomic<int64_t> size = ATOMIC_VAR_INIT(0);
+  std::atomic<uint64_t> drops = ATOMIC_VAR_INIT(0);
+  std::atomic<uint64_t> rejects = ATOMIC_VAR_INIT(0);
+  std::atomic<uint64_t> overflows = ATOMIC_VAR_INIT(0);
+
+  std::atomic_bool waiting = ATOMIC_VAR_INIT(false);
+  std::mutex mutex;
+  std::shared_ptr<Promise<Nothing>> promise;
+};
+
+} // namespace process {
+
+#endif // __PROCESS_MAILBOX_HPP__
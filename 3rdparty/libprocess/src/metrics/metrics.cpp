@@ -12,11 +12,18 @@
 
 #include <glog/logging.h>
 
+#include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <limits>
 #include <list>
+#include <map>
+#include <sstream>
 #include <string>
 #include <vector>
 
 #include <process/collect.hpp>
+#include <process/delay.hpp>
 #include <process/dispatch.hpp>
 #include <process/help.hpp>
 #include <process/owned.hpp>
@@ -31,6 +38,7 @@
 #include <stout/numify.hpp>
 #include <stout/option.hpp>
 #include <stout/os.hpp>
+#include <stout/strings.hpp>
 
 using std::list;
 using std::string;
@@ -88,7 +96,27 @@ MetricsProcess* MetricsProcess::create(
     }
   }
 
-  return new MetricsProcess(limiter, authenticationRealm);
+  Option<Duration> interval;
+
+  Option<string> sampling =
+    os::getenv("LIBPROCESS_METRICS_SNAPSHOT_INTERVAL");
+
+  if (sampling.isSome()) {
+    Try<Duration> duration = Duration::parse(sampling.get());
+
+    if (duration.isError() || duration.get() <= Duration::zero()) {
+      EXIT(EXIT_FAILURE)
+        << "Failed to parse LIBPROCESS_METRICS_SNAPSHOT_INTERVAL "
+        << "'" << sampling.get() << "'"
+        << (duration.isError()
+              ? ": " + duration.error()
+              : " (must be positive)");
+    }
+
+    interval = duration.get();
+  }
+
+  return new MetricsProcess(limiter, interval, authenticationRealm);
 }
 
 
@@ -99,12 +127,27 @@ void MetricsProcess::initialize()
           authenticationRealm.get(),
           help(),
           &MetricsProcess::_snapshot);
+
+    route("/prometheus",
+          authenticationRealm.get(),
+          prometheusHelp(),
+          &MetricsProcess::prometheus);
   } else {
     route("/snapshot",
           help(),
           [this](const http::Request& request) {
             return _snapshot(request, None());
           });
+
+    route("/prometheus",
+          prometheusHelp(),
+          [this](const http::Request& request) {
+            return prometheus(request, None());
+          });
+  }
+
+  if (interval.isSome()) {
+    sample();
   }
 }
 
@@ -121,11 +164,80 @@ string MetricsProcess::help()
           "amount of time the endpoint will take to respond. If the timeout",
           "is exceeded, some metrics may not be included in the response.",
           "",
-          "The key is the metric name, and the value is a double-type."),
+          "The key is the metric name, and the value is a double-type.",
+          "",
+          "If LIBPROCESS_METRICS_SNAPSHOT_INTERVAL is set, the metrics are",
+          "sampled in the background at that interval and this endpoint",
+          "responds right away with the last sample. The 'timeout' query",
+          "parameter and the rate limit then do not apply."),
       AUTHENTICATION(true));
 }
 
 
+string MetricsProcess::prometheusHelp()
+{
+  return HELP(
+      TLDR("Provides the current metrics in the Prometheus text format."),
+      DESCRIPTION(
+          "This endpoint provides the same metrics as the /snapshot endpoint",
+          "but in the Prometheus text exposition format, with the characters",
+          "of the metric names that Prometheus does not allow replaced by",
+          "underscores.",
+          "",
+          "The optional query parameter 'timeout' determines the maximum",
+          "amount of time the endpoint will take to respond. If the timeout",
+          "is exceeded, some metrics may not be included in the response.",
+          "",
+          "If LIBPROCESS_METRICS_SNAPSHOT_INTERVAL is set, the metrics are",
+          "sampled in the background at that interval and this endpoint",
+          "responds right away with the last sample. The 'timeout' query",
+          "parameter and the rate limit then do not apply."),
+      AUTHENTICATION(true));
+}
+
+
+// Renders the metrics in the Prometheus text exposition format, see
+// https://prometheus.io/docs/instrumenting/exposition_formats/.
+static string prometheusText(const hashmap<string, double>& metrics)
+{
+  // Sorted by name, to keep related metrics together.
+  const std::map<string, double> sorted(metrics.begin(), metrics.end());
+
+  std::ostringstream out;
+  out << std::setprecision(std::numeric_limits<double>::max_digits10);
+
+  foreachpair (const string& name, double value, sorted) {
+    // Metric names must match `[a-zA-Z_:][a-zA-Z0-9_:]*`.
+    string sanitized = name;
+    for (size_t i = 0; i < sanitized.size(); i++) {
+      const unsigned char c = sanitized[i];
+      if (!isalpha(c) && c != '_' && c != ':' && (i == 0 || !isdigit(c))) {
+        sanitized[i] = '_';
+      }
+    }
+
+    out << sanitized << " ";
+
+    if (std::isnan(value)) {
+      out << "NaN";
+    } else if (std::isinf(value)) {
+      out << (value > 0 ? "+Inf" : "-Inf");
+    } else {
+      out << value;
+    }
+
+    out << "\n";
+  }
+
+  return out.str();
+}
+
+
+MetricsProcess::Sample::Sample(const hashmap<string, double>& values)
+  : json(jsonify(values)),
+    prometheus(prometheusText(values)) {}
+
+
 Future<Nothing> MetricsProcess::add(Owned<Metric> metric)
 {
   if (metrics.contains(metric->name())) {
@@ -173,36 +285,110 @@ Future<hashmap<string, double>> MetricsProcess::snapshot(
 }
 
 
-Future<http::Response> MetricsProcess::_snapshot(
-    const http::Request& request,
-    const Option<http::authentication::Principal>&)
+void MetricsProcess::sample()
+{
+  // Gauges that take longer than the interval to be evaluated are
+  // left out of the sample, so that samples are taken regularly.
+  snapshot(interval.get())
+    .onAny(defer(self(), &Self::_sample, lambda::_1));
+}
+
+
+void MetricsProcess::_sample(
+    const Future<hashmap<string, double>>& snapshot)
 {
-  // Parse the 'timeout' parameter.
-  Option<Duration> timeout;
+  if (snapshot.isReady()) {
+    last = Sample(snapshot.get());
+  } else {
+    LOG(WARNING) << "Failed to sample the metrics: "
+                 << (snapshot.isFailed() ? snapshot.failure() : "discarded");
+  }
+
+  delay(interval.get(), self(), &Self::sample);
+}
+
 
-  if (request.url.query.contains("timeout")) {
-    string parameter = request.url.query.get("timeout").get();
+Try<Option<Duration>> MetricsProcess::timeout(const http::Request& request)
+{
+  if (!request.url.query.contains("timeout")) {
+    return None();
+  }
 
-    Try<Duration> duration = Duration::parse(parameter);
+  string parameter = request.url.query.get("timeout").get();
 
-    if (duration.isError()) {
-      return http::BadRequest(
-          "Invalid timeout '" + parameter + "': " + duration.error() + ".\n");
-    }
+  Try<Duration> duration = Duration::parse(parameter);
 
-    timeout = duration.get();
+  if (duration.isError()) {
+    return Error(
+        "Invalid timeout '" + parameter + "': " + duration.error() + ".\n");
   }
 
+  return duration.get();
+}
+
+
+Future<hashmap<string, double>> MetricsProcess::limitedSnapshot(
+    const Option<Duration>& timeout)
+{
   Future<Nothing> acquire = Nothing();
 
   if (limiter.isSome()) {
     acquire = limiter.get()->acquire();
   }
 
-  return acquire.then(defer(self(), &Self::snapshot, timeout))
-      .then([request](const hashmap<string, double>& metrics)
+  return acquire.then(defer(self(), &Self::snapshot, timeout));
+}
+
+
+Future<http::Response> MetricsProcess::_snapshot(
+    const http::Request& request,
+    const Option<http::authentication::Principal>&)
+{
+  const Option<string> jsonp = request.url.query.get("jsonp");
+
+  if (last.isSome()) {
+    if (jsonp.isSome()) {
+      return http::OK(
+          jsonp.get() + "(" + last->json + ");", "text/javascript");
+    }
+
+    return http::OK(last->json, "application/json");
+  }
+
+  Try<Option<Duration>> timeout = MetricsProcess::timeout(request);
+
+  if (timeout.isError()) {
+    return http::BadRequest(timeout.error());
+  }
+
+  return limitedSnapshot(timeout.get())
+      .then([jsonp](const hashmap<string, double>& metrics)
+            -> http::Response {
+        return http::OK(jsonify(metrics), jsonp);
+      });
+}
+
+
+Future<http::Response> MetricsProcess::prometheus(
+    const http::Request& request,
+    const Option<http::authentication::Principal>&)
+{
+  const string contentType = "text/plain; version=0.0.4";
+
+  if (last.isSome()) {
+    return http::OK(last->prometheus, contentType);
+  }
+
+  Try<Option<Duration>> timeout = MetricsProcess::timeout(request);
+
+  if (timeout.isError()) {
+    return http::BadRequest(timeout.error());
+  }
+
+  return limitedSnapshot(timeout.get())
+      .then([contentType](const hashmap<string, double>& metrics)
             -> http::Response {
-        return http::OK(jsonify(metrics), request.url.query.get("jsonp"));
+        return http::OK(prometheusText(metrics), contentType);
       });
 }
 
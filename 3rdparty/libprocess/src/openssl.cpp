@@ -21,6 +21,7 @@
 #include <openssl/ssl.h>
 #include <openssl/x509v3.h>
 
+#include <list>
 #include <map>
 #include <mutex>
 #include <string>
@@ -30,6 +31,7 @@
 
 #include <process/ssl/flags.hpp>
 
+#include <stout/hashmap.hpp>
 #include <stout/os.hpp>
 #include <stout/strings.hpp>
 
@@ -42,6 +44,7 @@
 #include <openssl/applink.c>
 #endif // __WINDOWS__
 
+using std::list;
 using std::map;
 using std::ostringstream;
 using std::string;
@@ -159,6 +162,26 @@ Flags::Flags()
       "enable_tls_v1_2",
       "Enable SSLV1.2.",
       true);
+
+  add(&Flags::enable_session_resumption,
+      "enable_session_resumption",
+      "Enable TLS session resumption. Accepting sockets keep a session "
+      "cache and issue session tickets, and connecting sockets offer the "
+      "last session negotiated with the same peer, which lets reconnects "
+      "skip the full handshake.",
+      true);
+
+  add(&Flags::session_cache_size,
+      "session_cache_size",
+      "Maximum number of sessions kept by the server side session cache "
+      "and, separately, by the client side session cache.",
+      20480);
+
+  add(&Flags::session_timeout,
+      "session_timeout",
+      "Time after which a cached session or session ticket can no longer "
+      "be resumed.",
+      Minutes(5));
 }
 
 
@@ -172,6 +195,136 @@ const Flags& flags()
 }
 
 
+// Cache of the sessions negotiated by connecting sockets, keyed by
+// peer, so that reconnecting to the same peer can resume the session
+// rather than doing a full handshake. See 'resume'.
+//
+// NOTE: OpenSSL's own session cache is only used on the server side;
+// it has no notion of which session to offer to which peer.
+class ClientSessionCache
+{
+public:
+  // Offers the cached session for 'peer', if any, on 'ssl'.
+  void offer(SSL* ssl, const string& peer)
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+
+    if (!sessions.contains(peer)) {
+      return;
+    }
+
+    SSL_SESSION* session = sessions.at(peer);
+
+    if (expired(session)) {
+      SSL_SESSION_free(session);
+      sessions.erase(peer);
+      order.remove(peer);
+      return;
+    }
+
+    // NOTE: 'SSL_set_session' takes its own reference.
+    if (SSL_set_session(ssl, session) != 1) {
+      VLOG(1) << "Failed to offer cached session for " << peer;
+    }
+  }
+
+  // Caches 'session' for 'peer', taking ownership of it. At most
+  // 'capacity' sessions are kept, evicting the oldest first.
+  void put(const string& peer, SSL_SESSION* session, size_t capacity)
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+
+    if (sessions.contains(peer)) {
+      SSL_SESSION_free(sessions.at(peer));
+      sessions.erase(peer);
+      order.remove(peer);
+    }
+
+    if (capacity == 0) {
+      SSL_SESSION_free(session);
+      return;
+    }
+
+    while (sessions.size() >= capacity) {
+      SSL_SESSION_free(sessions.at(order.front()));
+      sessions.erase(order.front());
+      order.pop_front();
+    }
+
+    sessions[peer] = session;
+    order.push_back(peer);
+  }
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+
+    foreachvalue (SSL_SESSION* session, sessions) {
+      SSL_SESSION_free(session);
+    }
+
+    sessions.clear();
+    order.clear();
+  }
+
+private:
+  static bool expired(SSL_SESSION* session)
+  {
+    return ::time(nullptr) >=
+      SSL_SESSION_get_time(session) + SSL_SESSION_get_timeout(session);
+  }
+
+  std::mutex mutex;
+  hashmap<string, SSL_SESSION*> sessions;
+
+  // The peers in the order their sessions were cached, for eviction.
+  list<string> order;
+};
+
+
+static ClientSessionCache* client_sessions = new ClientSessionCache();
+
+
+// Index of the SSL "ex data" that holds the peer a connecting socket
+// is connecting to, see 'resume'. Allocated once in 'reinitialize'.
+static int peer_index = -1;
+
+
+// Frees the peer held at 'peer_index' when its SSL object is freed.
+static void free_peer(
+    void* /*parent*/,
+    void* peer,
+    CRYPTO_EX_DATA* /*data*/,
+    int /*index*/,
+    long /*argl*/,
+    void* /*argp*/)
+{
+  delete static_cast<string*>(peer);
+}
+
+
+// OpenSSL callback invoked for every newly negotiated session. For
+// connecting sockets we cache the session under its peer. With TLS
+// v1.3 this happens after the handshake, once the server has sent
+// its session ticket.
+static int new_session_callback(SSL* ssl, SSL_SESSION* session)
+{
+  if (SSL_is_server(ssl)) {
+    return 0; // The server side cache is maintained by OpenSSL.
+  }
+
+  const string* peer = static_cast<string*>(SSL_get_ex_data(ssl, peer_index));
+  if (peer == nullptr) {
+    return 0;
+  }
+
+  client_sessions->put(*peer, session, ssl_flags->session_cache_size);
+
+  // Returning 1 tells OpenSSL that we took the reference.
+  return 1;
+}
+
+
 // Mutexes necessary to support OpenSSL locking on shared data
 // structures. See 'locking_function' for more information.
 static std::mutex* mutexes = nullptr;
@@ -447,6 +600,9 @@ void reinitialize()
     CRYPTO_set_dynlock_lock_callback(&dyn_lock_function);
     CRYPTO_set_dynlock_destroy_callback(&dyn_destroy_function);
 
+    peer_index = SSL_get_ex_new_index(0, nullptr, nullptr, nullptr, &free_peer);
+    CHECK_NE(-1, peer_index) << "Failed to allocate SSL ex data index";
+
     initialized_single_entry->done();
   }
 
@@ -457,18 +613,34 @@ void reinitialize()
     ctx = nullptr;
   }
 
+  // Sessions negotiated under the previous context (and settings)
+  // should not be resumed.
+  client_sessions->clear();
+
   // Replace with `TLS_method` once our minimum OpenSSL version
   // supports it.
   ctx = SSL_CTX_new(SSLv23_method());
   CHECK(ctx) << "Failed to create SSL context: "
              << ERR_error_string(ERR_get_error(), nullptr);
 
-  // Disable SSL session caching.
-  SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+  if (ssl_flags->enable_session_resumption) {
+    // The server side sessions are kept in OpenSSL's internal cache
+    // (and in session tickets, which are enabled by default). The
+    // client side sessions are handed to 'new_session_callback',
+    // see 'resume'.
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_BOTH);
+    SSL_CTX_sess_set_cache_size(ctx, ssl_flags->session_cache_size);
+    SSL_CTX_set_timeout(
+        ctx, static_cast<long>(ssl_flags->session_timeout.secs()));
+    SSL_CTX_sess_set_new_cb(ctx, &new_session_callback);
+  } else {
+    SSL_CTX_set_session_cache_mode(ctx, SSL_SESS_CACHE_OFF);
+    SSL_CTX_set_options(ctx, SSL_OP_NO_TICKET);
+  }
 
-  // Set a session id to avoid connection termination upon
-  // re-connect. We can use something more relevant when we care
-  // about session caching.
+  // Set a session id context, which OpenSSL requires for resuming
+  // sessions of peers that presented a certificate. All libprocess
+  // sockets share the same context, hence the same constant.
   const uint64_t session_ctx = 7;
 
   const unsigned char* session_id =
@@ -711,6 +883,23 @@ SSL_CTX* context()
 }
 
 
+void resume(SSL* ssl, const string& peer)
+{
+  if (!ssl_flags->enable_session_resumption) {
+    return;
+  }
+
+  // Remember the peer so that 'new_session_callback' can cache any
+  // new session under it. Freed by 'free_peer' along with 'ssl'.
+  if (SSL_set_ex_data(ssl, peer_index, new string(peer)) != 1) {
+    VLOG(1) << "Failed to set the peer for session resumption";
+    return;
+  }
+
+  client_sessions->offer(ssl, peer);
+}
+
+
 Try<Nothing> verify(
     const SSL* const ssl,
     const Option<string>& hostname,
@@ -52,6 +52,9 @@ namespace openssl {
 //    LIBPROCESS_SSL_ENABLE_TLS_V1_1=(false|0,true|1)
 //    LIBPROCESS_SSL_ENABLE_TLS_V1_2=(false|0,true|1)
 //    LIBPROCESS_SSL_ECDH_CURVES=(auto|list of curves separated by ':')
+//    LIBPROCESS_SSL_ENABLE_SESSION_RESUMPTION=(false|0,true|1)
+//    LIBPROCESS_SSL_SESSION_CACHE_SIZE=(20480)
+//    LIBPROCESS_SSL_SESSION_TIMEOUT=(5mins)
 //
 // TODO(benh): When/If we need to support multiple contexts in the
 // same process, for example for Server Name Indication (SNI), then
@@ -63,6 +66,14 @@ void initialize();
 // Returns the _global_ OpenSSL context.
 SSL_CTX* context();
 
+// Prepares a client connection to 'peer' (e.g., "ip:port") for
+// session resumption: a session previously negotiated with the same
+// peer is offered to the server, and any new session negotiated on
+// this connection is cached for the next one. This is a no-op if
+// session resumption is disabled. Must be called before the
+// handshake starts.
+void resume(SSL* ssl, const std::string& peer);
+
 // Verify that the hostname is properly associated with the peer
 // certificate associated with the specified SSL connection.
 Try<Nothing> verify(
@@ -14,9 +14,17 @@
 #ifdef __WINDOWS__
 #include <stout/windows.hpp>
 #else
+#include <limits.h>
+
 #include <netinet/tcp.h>
+
+#include <sys/uio.h>
 #endif // __WINDOWS__
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <process/io.hpp>
 #include <process/network.hpp>
 #include <process/socket.hpp>
@@ -28,7 +36,9 @@
 #include "config.hpp"
 #include "poll_socket.hpp"
 
+using std::pair;
 using std::string;
+using std::vector;
 
 namespace process {
 namespace network {
@@ -114,7 +124,10 @@ Future<std::shared_ptr<SocketImpl>> PollSocketImpl::accept()
   return io::poll(get(), io::READ)
     .then(lambda::bind(&internal::accept, get()))
     .then([](int_fd s) -> Future<std::shared_ptr<SocketImpl>> {
-      Try<std::shared_ptr<SocketImpl>> impl = create(s);
+      // NOTE: We go through `SocketImpl::create` since accepted sockets
+      // might not be a `PollSocketImpl` (e.g., an `IoUringSocketImpl`).
+      Try<std::shared_ptr<SocketImpl>> impl =
+        SocketImpl::create(s, SocketImpl::Kind::POLL);
       if (impl.isError()) {
         os::close(s);
         return Failure("Failed to create socket: " + impl.error());
@@ -263,6 +276,59 @@ Future<size_t> socket_send_file(
   }
 }
 
+
+#ifndef __WINDOWS__
+Future<size_t> socket_send_buffers(
+    const std::shared_ptr<PollSocketImpl>& impl,
+    const vector<pair<const char*, size_t>>& buffers)
+{
+  CHECK(!buffers.empty());
+
+  // Any buffers beyond `IOV_MAX` are left for the caller to send
+  // with a subsequent call, just like any other partial send.
+  vector<struct iovec> iov(
+      std::min(buffers.size(), static_cast<size_t>(IOV_MAX)));
+  for (size_t i = 0; i < iov.size(); i++) {
+    CHECK(buffers[i].second > 0);
+    iov[i].iov_base = const_cast<char*>(buffers[i].first);
+    iov[i].iov_len = buffers[i].second;
+  }
+
+  struct msghdr message = {};
+  message.msg_iov = iov.data();
+  message.msg_iovlen = iov.size();
+
+  while (true) {
+    ssize_t length = ::sendmsg(impl->get(), &message, MSG_NOSIGNAL);
+
+    int error = errno;
+
+    if (length < 0 && net::is_restartable_error(error)) {
+      // Interrupted, try again now.
+      continue;
+    } else if (length < 0 && net::is_retryable_error(error)) {
+      // Might block, try again later.
+      return io::poll(impl->get(), io::WRITE)
+        .then(lambda::bind(&internal::socket_send_buffers, impl, buffers));
+    } else if (length <= 0) {
+      // Socket error or closed.
+      if (length < 0) {
+        const string error = os::strerror(errno);
+        VLOG(1) << "Socket error while sending: " << error;
+        return Failure(ErrnoError("Socket send failed"));
+      } else {
+        VLOG(1) << "Socket closed while sending";
+        return length;
+      }
+    } else {
+      CHECK(length > 0);
+
+      return length;
+    }
+  }
+}
+#endif // __WINDOWS__
+
 } // namespace internal {
 
 
@@ -288,6 +354,19 @@ Future<size_t> PollSocketImpl::sendfile(int_fd fd, off_t offset, size_t size)
         size));
 }
 
+
+#ifndef __WINDOWS__
+Future<size_t> PollSocketImpl::send(
+    const vector<pair<const char*, size_t>>& buffers)
+{
+  return io::poll(get(), io::WRITE)
+    .then(lambda::bind(
+        &internal::socket_send_buffers,
+        shared(this),
+        buffers));
+}
+#endif // __WINDOWS__
+
 } // namespace internal {
 } // namespace network {
 } // namespace process {
@@ -10,6 +10,9 @@
 // See the License for the specific language governing permissions and
 // limitations under the License
 
+#ifndef __POLL_SOCKET_HPP__
+#define __POLL_SOCKET_HPP__
+
 #include <memory>
 
 #include <process/socket.hpp>
@@ -36,9 +39,15 @@ public:
   virtual Future<size_t> recv(char* data, size_t size);
   virtual Future<size_t> send(const char* data, size_t size);
   virtual Future<size_t> sendfile(int_fd fd, off_t offset, size_t size);
+#ifndef __WINDOWS__
+  virtual Future<size_t> send(
+      const std::vector<std::pair<const char*, size_t>>& buffers);
+#endif // __WINDOWS__
   virtual Kind kind() const { return SocketImpl::Kind::POLL; }
 };
 
 } // namespace internal {
 } // namespace network {
 } // namespace process {
+
+#endif // __POLL_SOCKET_HPP__
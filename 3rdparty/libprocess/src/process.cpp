@@ -43,6 +43,7 @@
 #endif // __WINDOWS__
 
 #include <algorithm>
+#include <cstddef>
 #include <deque>
 #include <fstream>
 #include <iomanip>
@@ -84,8 +85,11 @@
 #include <process/system.hpp>
 #include <process/time.hpp>
 #include <process/timer.hpp>
+#include <process/timeseries.hpp>
 
+#include <process/metrics/gauge.hpp>
 #include <process/metrics/metrics.hpp>
+#include <process/metrics/push_gauge.hpp>
 
 #include <process/ssl/flags.hpp>
 
@@ -93,6 +97,7 @@
 #include <process/windows/jobobject.hpp>
 #endif // __WINDOWS__
 
+#include <stout/bytes.hpp>
 #include <stout/duration.hpp>
 #include <stout/flags.hpp>
 #include <stout/foreach.hpp>
@@ -114,7 +119,12 @@
 #include "event_loop.hpp"
 #include "event_queue.hpp"
 #include "gate.hpp"
+#ifdef USE_IO_URING
+#include "io_uring.hpp"
+#endif
+#include "mailbox.hpp"
 #include "process_reference.hpp"
+#include "process_statistics.hpp"
 #include "run_queue.hpp"
 
 namespace inet = process::network::inet;
@@ -244,6 +254,75 @@ struct Flags : public virtual flags::FlagsBase
         "libprocess is listening may not match the address from\n"
         "which libprocess connects to other actors.\n",
         false);
+
+    add(&Flags::enable_message_framing,
+        "enable_message_framing",
+        "If set, libprocess asks the peer of every new link to switch\n"
+        "from HTTP to length-prefixed binary frames for messages, and\n"
+        "accepts such requests from its own peers. Links to peers that\n"
+        "do not agree (e.g., older versions of libprocess) keep using\n"
+        "HTTP.\n",
+        false);
+
+    add(&Flags::enable_process_statistics,
+        "enable_process_statistics",
+        "If set, libprocess keeps statistics about the event queue of\n"
+        "every process (e.g., its size and how long events wait in it)\n"
+        "and the time spent handling each type of event. These are\n"
+        "exposed by the '/__process_statistics__' endpoint and as\n"
+        "'libprocess/processes/<id>/...' metrics.\n",
+        false);
+
+    add(&Flags::http_compression_level,
+        "http_compression_level",
+        "The zlib compression level used for HTTP responses to clients\n"
+        "that accept the 'gzip' or 'deflate' content coding, from 1 for\n"
+        "the fastest to 9 for the best compression, or -1 for the zlib\n"
+        "default. A level of 0 disables compression.\n",
+        Z_DEFAULT_COMPRESSION,
+        [](int value) -> Option<Error> {
+          if (value < Z_DEFAULT_COMPRESSION || value > Z_BEST_COMPRESSION) {
+            return Error("Expected a compression level within [-1, 9]");
+          }
+
+          return None();
+        });
+
+    add(&Flags::http_compression_min_size,
+        "http_compression_min_size",
+        "The size below which HTTP response bodies are not compressed.\n"
+        "Streamed responses are only compressed if the handler asks for\n"
+        "it, regardless of their size.\n",
+        Bytes(GZIP_MINIMUM_BODY_LENGTH));
+
+    add(&Flags::send_batch_max_bytes,
+        "send_batch_max_bytes",
+        "The maximum number of bytes that libprocess hands to a single\n"
+        "(vectored) send when several messages or responses are queued\n"
+        "for the same socket. A single message or response larger than\n"
+        "this is still sent on its own.\n",
+        Megabytes(1),
+        [](const Bytes& value) -> Option<Error> {
+          if (value == Bytes(0)) {
+            return Error("Expected a positive number of bytes");
+          }
+
+          return None();
+        });
+
+    add(&Flags::send_batch_max_buffers,
+        "send_batch_max_buffers",
+        "The maximum number of messages or responses queued for the\n"
+        "same socket that libprocess hands to a single (vectored) send.\n"
+        "A value of 1 sends each of them with its own system call.\n",
+        64,
+        [](size_t value) -> Option<Error> {
+          if (value == 0) {
+            return Error("Expected a positive number of buffers");
+          }
+
+          return None();
+        });
   }
 
   Option<net::IP> ip;
@@ -252,6 +331,12 @@ struct Flags : public virtual flags::FlagsBase
   Option<int> port;
   Option<int> advertise_port;
   bool require_peer_address_ip_match;
+  bool enable_message_framing;
+  bool enable_process_statistics;
+  int http_compression_level;
+  Bytes http_compression_min_size;
+  Bytes send_batch_max_bytes;
+  size_t send_batch_max_buffers;
 };
 
 } // namespace internal {
@@ -286,11 +371,14 @@ map<string, string> types;
 // satisfy HTTP/1.1 pipelining. Each request should either enqueue a
 // response, or ask the proxy to handle a future response. The process
 // is responsible for making sure the responses are sent in the same
-// order as the requests. Note that we use a 'Socket' in order to keep
-// the underlying file descriptor from getting closed while there
-// might still be outstanding responses even though the client might
-// have closed the connection (see more discussion in
-// SocketManager::close and SocketManager::proxy).
+// order as the requests. The proxy waits on all the outstanding
+// responses at once, so a slow response only holds back the responses
+// after it on the wire: they still get handled concurrently and are
+// all sent as soon as the slow response has been sent. Note that we
+// use a 'Socket' in order to keep the underlying file descriptor from
+// getting closed while there might still be outstanding responses
+// even though the client might have closed the connection (see more
+// discussion in SocketManager::close and SocketManager::proxy).
 class HttpProxy : public Process<HttpProxy>
 {
 public:
@@ -310,14 +398,16 @@ protected:
   void finalize() override;
 
 private:
-  // Starts "waiting" on the next available future response.
+  // Sends all the responses at the front of the queue that are no
+  // longer pending, stopping at a pending or streaming response.
   void next();
 
   // Invoked once a future response has been satisfied.
   void waited(const Future<Response>& future);
 
-  // Demuxes and handles a response.
-  bool process(const Future<Response>& future, const Request& request);
+  // Demuxes and handles a response, starting to stream it (i.e.,
+  // setting `pipe`) if it is a pipe.
+  void process(const Future<Response>& future, const Request& request);
 
   // Handles stream based responses.
   void stream(const Owned<Request>& request, const Future<string>& chunk);
@@ -340,6 +430,29 @@ private:
   queue<Item*> items;
 
   Option<http::Pipe::Reader> pipe; // Current pipe, if streaming.
+
+  // Compresses the current pipe, if streaming a compressed response.
+  Owned<gzip::Compressor> compressor;
+};
+
+
+// Metrics about the HTTP/1.1 pipelining done by all the `HttpProxy`s.
+struct HttpProxyMetrics
+{
+  HttpProxyMetrics()
+    : pipelined_requests("libprocess/http/pipelined_requests"),
+      pipelining_depth(
+          "libprocess/http/pipelining_depth",
+          TIME_SERIES_WINDOW) {}
+
+  // The number of requests on all connections whose response has not
+  // been sent yet.
+  metrics::PushGauge pipelined_requests;
+
+  // The number of requests on a connection whose response has not
+  // been sent yet, pushed whenever a request is enqueued, so that its
+  // statistics describe how deep the connections are pipelined.
+  metrics::PushGauge pipelining_depth;
 };
 
 
@@ -431,6 +544,22 @@ public:
 
   Encoder* next(int_fd s);
 
+  // Moves the data encoders queued for the socket onto the end of
+  // 'batch' so that they can all be written with a single (vectored)
+  // send, up to LIBPROCESS_SEND_BATCH_MAX_BYTES and
+  // LIBPROCESS_SEND_BATCH_MAX_BUFFERS. Also accounts for the send in
+  // the socket's statistics (see `__sockets__`).
+  void coalesce(const Socket& socket, vector<DataEncoder*>* batch);
+
+  // The /__sockets__ route, which returns the send statistics of
+  // each active socket.
+  Future<Response> __sockets__(const Request&);
+
+  // Invoked once the peer of a link has responded to our request to
+  // switch to binary message frames. Sends any messages that were
+  // queued while waiting, either as frames or as HTTP requests.
+  void negotiated(const Socket& socket, bool framing);
+
   void close(int_fd s);
 
   void exited(const Address& address);
@@ -494,6 +623,30 @@ private:
   // Map from outbound socket to outgoing queue.
   hashmap<int_fd, queue<Encoder*>> outgoing;
 
+  // Map from persistent socket to the messages sent while we wait for
+  // the peer to respond to our request to use binary message frames.
+  // We can't encode these until we know which encoding to use.
+  hashmap<int_fd, queue<Message>> negotiating;
+
+  // Persistent sockets whose peer agreed to binary message frames.
+  hashset<int_fd> framed;
+
+  // Statistics about the sends of queued data on each socket.
+  struct SendStatistics
+  {
+    // Number of sends, including the sends of partially sent data.
+    uint64_t sends = 0;
+
+    // Total number of encoders and bytes handed to those sends.
+    uint64_t buffers = 0;
+    uint64_t bytes = 0;
+
+    // Largest number of encoders handed to a single send.
+    uint64_t max_buffers = 0;
+  };
+
+  hashmap<int_fd, SendStatistics> statistics;
+
   // HTTP proxies.
   hashmap<int_fd, HttpProxy*> proxies;
 
@@ -515,25 +668,38 @@ public:
   // This is a prerequisite for finalizing the `SocketManager`.
   void finalize();
 
-  // Initializes the processing threads and the event loop thread,
+  // Initializes the processing threads and the event loop threads,
   // and returns the number of processing threads created.
   long init_threads();
 
   ProcessReference use(const UPID& pid);
 
-  void handle(
+  // Returns (while the mailbox of the receiver of a message applies
+  // backpressure, see `deliver`) a future that becomes ready once the
+  // next request may be read from the socket.
+  Option<Future<Nothing>> handle(
       const Socket& socket,
       Request* request);
 
+  // Delivers the event to the receiver. A message is subject to the
+  // mailbox limit of the receiver, if any (see `ProcessBase::limit`).
+  //
+  // 'backpressure' is only passed for messages received from remote
+  // peers: it gets set if the mailbox of the receiver is full and
+  // applies backpressure to the message, to a future that becomes
+  // ready once the mailbox has room again. No more messages should be
+  // read from the peer until then.
   bool deliver(
       ProcessBase* receiver,
       Event* event,
-      ProcessBase* sender = nullptr);
+      ProcessBase* sender = nullptr,
+      Option<Future<Nothing>>* backpressure = nullptr);
 
   bool deliver(
       const UPID& to,
       Event* event,
-      ProcessBase* sender = nullptr);
+      ProcessBase* sender = nullptr,
+      Option<Future<Nothing>>* backpressure = nullptr);
 
   // TODO(josephw): Change the return type to a `Try<UPID>`. Currently,
   // if this method fails, we return a default constructed `UPID`.
@@ -561,6 +727,10 @@ public:
   // The /__processes__ route.
   Future<Response> __processes__(const Request&);
 
+  // The /__process_statistics__ route, which returns the statistics
+  // of the busiest processes (see `ProcessStatistics`).
+  Future<Response> __process_statistics__(const Request&);
+
   void install(Filter* f)
   {
     // NOTE: even though `filter` is atomic we still need to
@@ -575,7 +745,8 @@ public:
 
   long workers() const
   {
-    return threads.size() - 1; // Less 1 for event loop thread.
+    // Less the event loop threads.
+    return threads.size() - EventLoop::loops();
   }
 
 private:
@@ -661,6 +832,20 @@ static AuthorizationCallbacks* authorization_callbacks = nullptr;
 // Global route that returns process information.
 static Route* processes_route = nullptr;
 
+// Global route that returns socket information.
+static Route* sockets_route = nullptr;
+
+// Global route that returns process statistics.
+static Route* process_statistics_route = nullptr;
+
+// Metrics of the `HttpProxy`s, created the first time libprocess gets
+// initialized and kept across reinitialization.
+static HttpProxyMetrics* http_proxy_metrics = nullptr;
+
+// Settings for compressing HTTP responses (see `process::initialize`).
+int HttpCompression::level = Z_DEFAULT_COMPRESSION;
+size_t HttpCompression::minimum = GZIP_MINIMUM_BODY_LENGTH;
+
 // Global help.
 PID<Help> help;
 
@@ -673,6 +858,109 @@ thread_local ProcessBase* __process__ = nullptr;
 // Per-thread executor pointer.
 thread_local Executor* _executor_ = nullptr;
 
+
+// A per-thread cache of freed `Event` allocations, binned by size.
+// Most events are freed by a worker thread right after being handled
+// so the next event enqueued from that thread can reuse the memory
+// without a trip through the allocator. Each bin is bounded so that a
+// thread which mostly frees (but never allocates) events doesn't hoard
+// memory; anything beyond that goes back to the heap.
+class EventPool
+{
+public:
+  // Allocations are rounded up to a multiple of `GRANULARITY` bytes
+  // and anything larger than `BINS * GRANULARITY` isn't pooled.
+  static constexpr size_t GRANULARITY = alignof(std::max_align_t);
+  static constexpr size_t BINS = 32;
+  static constexpr size_t CAPACITY = 1024;
+
+  ~EventPool()
+  {
+    destroyed = true;
+
+    foreach (Bin& bin, bins) {
+      while (bin.head != nullptr) {
+        Block* block = bin.head;
+        bin.head = block->next;
+        ::operator delete(block);
+      }
+    }
+  }
+
+  static void* allocate(size_t size)
+  {
+    const size_t index = (size + GRANULARITY - 1) / GRANULARITY;
+
+    if (index < BINS && !destroyed) {
+      Bin& bin = pool.bins[index];
+      if (bin.head != nullptr) {
+        Block* block = bin.head;
+        bin.head = block->next;
+        bin.size--;
+        return block;
+      }
+    }
+
+    return ::operator new(index * GRANULARITY);
+  }
+
+  static void deallocate(void* pointer, size_t size)
+  {
+    const size_t index = (size + GRANULARITY - 1) / GRANULARITY;
+
+    if (index < BINS && !destroyed) {
+      Bin& bin = pool.bins[index];
+      if (bin.size < CAPACITY) {
+        Block* block = static_cast<Block*>(pointer);
+        block->next = bin.head;
+        bin.head = block;
+        bin.size++;
+        return;
+      }
+    }
+
+    ::operator delete(pointer);
+  }
+
+private:
+  struct Block
+  {
+    Block* next;
+  };
+
+  struct Bin
+  {
+    Block* head = nullptr;
+    size_t size = 0;
+  };
+
+  Bin bins[BINS];
+
+  static thread_local EventPool pool;
+
+  // NOTE: Events can still be freed while a thread is exiting, after
+  // its pool has been destroyed, in which case we bypass the pool.
+  // This is trivially destructible so it remains safe to read.
+  static thread_local bool destroyed;
+};
+
+
+thread_local EventPool EventPool::pool;
+thread_local bool EventPool::destroyed = false;
+
+
+void* Event::operator new(size_t size)
+{
+  return EventPool::allocate(size);
+}
+
+
+void Event::operator delete(void* event, size_t size)
+{
+  EventPool::deallocate(event, size);
+}
+
+
 namespace metrics {
 namespace internal {
 
@@ -839,20 +1127,14 @@ static void transport(
 }
 
 
-// Returns true if `request` contains an inbound libprocess message.
-// A libprocess message can either be sent by another instance of
-// libprocess (i.e. both of the "User-Agent" and "Libprocess-From"
-// headers will be set), or a client that speaks the libprocess
-// protocol (i.e. only the "Libprocess-From" header will be set).
-// This function returns true for either case.
-static bool libprocess(Request* request)
+// Returns true if `request` asks to switch the connection from HTTP
+// to binary message frames (see `MessageFrameEncoder`).
+static bool upgrade(const Request& request)
 {
   return
-    (request->method == "POST" &&
-     request->headers.contains("User-Agent") &&
-     request->headers["User-Agent"].find("libprocess/") == 0) ||
-    (request->method == "POST" &&
-     request->headers.contains("Libprocess-From"));
+    request.method == "GET" &&
+    request.headers.contains("Upgrade") &&
+    request.headers.at("Upgrade") == MESSAGE_FRAMING_PROTOCOL;
 }
 
 
@@ -875,7 +1157,7 @@ static Future<Owned<Request>> convert(Owned<Request>&& pipeRequest)
 }
 
 
-static Future<MessageEvent*> parse(const Request& request)
+static Future<MessageEvent*> parse(Request* request)
 {
   // TODO(benh): Do better error handling (to deal with a malformed
   // libprocess message, malicious or otherwise).
@@ -883,11 +1165,11 @@ static Future<MessageEvent*> parse(const Request& request)
   // First try and determine 'from'.
   Option<UPID> from = None();
 
-  if (request.headers.contains("Libprocess-From")) {
-    from = UPID(strings::trim(request.headers.at("Libprocess-From")));
+  if (request->headers.contains("Libprocess-From")) {
+    from = UPID(strings::trim(request->headers.at("Libprocess-From")));
   } else {
     // Try and get 'from' from the User-Agent.
-    const string& agent = request.headers.at("User-Agent");
+    const string& agent = request->headers.at("User-Agent");
     const string identifier = "libprocess/";
     size_t index = agent.find(identifier);
     if (index != string::npos) {
@@ -900,16 +1182,16 @@ static Future<MessageEvent*> parse(const Request& request)
   }
 
   // Check that URL path is present and starts with '/'.
-  if (request.url.path.find('/') != 0) {
+  if (request->url.path.find('/') != 0) {
     return Failure("Request URL path must start with '/'");
   }
 
   // Now determine 'to'.
-  size_t index = request.url.path.find('/', 1);
+  size_t index = request->url.path.find('/', 1);
   index = index != string::npos ? index - 1 : string::npos;
 
   // Decode possible percent-encoded 'to'.
-  Try<string> decode = http::decode(request.url.path.substr(1, index));
+  Try<string> decode = http::decode(request->url.path.substr(1, index));
 
   if (decode.isError()) {
     return Failure("Failed to decode URL path: " + decode.error());
@@ -918,14 +1200,28 @@ static Future<MessageEvent*> parse(const Request& request)
   const UPID to(decode.get(), __address__);
 
   // And now determine 'name'.
-  index = index != string::npos ? index + 2: request.url.path.size();
-  const string name = request.url.path.substr(index);
+  index = index != string::npos ? index + 2: request->url.path.size();
+  const string name = request->url.path.substr(index);
 
   VLOG(2) << "Parsed message name '" << name
           << "' for " << to << " from " << from.get();
 
-  CHECK_SOME(request.reader);
-  http::Pipe::Reader reader = request.reader.get(); // Remove const.
+  // The decoder buffers the body of a message unless it is compressed
+  // (see `StreamingRequestDecoder`), in which case we read it here.
+  if (request->type == Request::BODY) {
+    Message message;
+    message.name = name;
+    message.from = from.get();
+    message.to = to;
+    message.body = std::move(request->body);
+
+    request->body.clear();
+
+    return new MessageEvent(std::move(message));
+  }
+
+  CHECK_SOME(request->reader);
+  http::Pipe::Reader reader = request->reader.get();
 
   return reader.readAll()
     .then([from, name, to](const string& body) {
@@ -942,6 +1238,124 @@ static Future<MessageEvent*> parse(const Request& request)
 
 namespace internal {
 
+void decode_frames_recv(
+    const Future<size_t>& length,
+    char* data,
+    size_t size,
+    Socket socket,
+    MessageFrameDecoder* decoder)
+{
+  if (length.isDiscarded() || length.isFailed()) {
+    if (length.isFailed()) {
+      VLOG(1) << "Decode failure: " << length.failure();
+    }
+
+    socket_manager->close(socket);
+    delete[] data;
+    delete decoder;
+    return;
+  }
+
+  if (length.get() == 0) {
+    socket_manager->close(socket);
+    delete[] data;
+    delete decoder;
+    return;
+  }
+
+  deque<Message*> messages = decoder->decode(data, length.get());
+
+  // After a malformed frame we can no longer tell where the next
+  // frame starts, so we give up on the connection.
+  if (decoder->failed()) {
+    VLOG(1) << "Decoder error while receiving message frames";
+    socket_manager->close(socket);
+    foreach (Message* message, messages) {
+      delete message;
+    }
+    delete[] data;
+    delete decoder;
+    return;
+  }
+
+  // Set if the mailbox of a receiver is full and applies backpressure,
+  // in which case we stop reading from the socket until it has room.
+  Option<Future<Nothing>> backpressure = None();
+
+  if (!messages.empty()) {
+    Option<Address> client = None();
+
+    if (libprocess_flags->require_peer_address_ip_match) {
+      Try<Address> address = socket.peer();
+
+      if (address.isError()) {
+        VLOG(1) << "Failed to get peer address while receiving: "
+                << address.error();
+        socket_manager->close(socket);
+        foreach (Message* message, messages) {
+          delete message;
+        }
+        delete[] data;
+        delete decoder;
+        return;
+      }
+
+      client = address.get();
+    }
+
+    foreach (Message* message, messages) {
+      // Verify that the UPID this peer is claiming is on the same IP
+      // address the peer is sending from. Unlike with HTTP there is
+      // no response to reject the message with, so we just drop it.
+      if (client.isSome() && message->from.address.ip != client->ip) {
+        VLOG(1) << "Dropping message '" << message->name << "' from "
+                << message->from << " which was sent from IP " << client->ip
+                << " (UPID IP address validation failed)";
+        delete message;
+        continue;
+      }
+
+      MessageEvent* event = new MessageEvent(std::move(*message));
+      delete message;
+
+      Option<Future<Nothing>> room = None();
+
+      // TODO(benh): Use the sender PID when delivering in order to
+      // capture happens-before timing relationships for testing.
+      if (!process_manager->deliver(
+              event->message.to, event, nullptr, &room)) {
+        VLOG(1) << "Failed to deliver libprocess message to "
+                << event->message.to;
+      }
+
+      if (room.isSome()) {
+        backpressure = room;
+      }
+    }
+  }
+
+  if (backpressure.isSome() && backpressure->isPending()) {
+    VLOG(2) << "Pausing reading messages until the mailbox of the"
+            << " receiver has room";
+
+    // NOTE: if the mailboxes of several receivers are full we only
+    // wait for the last one, the others apply backpressure again on
+    // the next message they receive.
+    backpressure->onAny([=]() {
+      socket.recv(data, size)
+        .onAny(lambda::bind(
+            &decode_frames_recv, lambda::_1, data, size, socket, decoder));
+    });
+
+    return;
+  }
+
+  socket.recv(data, size)
+    .onAny(lambda::bind(
+        &decode_frames_recv, lambda::_1, data, size, socket, decoder));
+}
+
+
 void decode_recv(
     const Future<size_t>& length,
     char* data,
@@ -968,7 +1382,7 @@ void decode_recv(
   }
 
   // Decode as much of the data as possible into HTTP requests.
-  const deque<Request*> requests = decoder->decode(data, length.get());
+  deque<Request*> requests = decoder->decode(data, length.get());
 
   if (requests.empty() && decoder->failed()) {
      VLOG(1) << "Decoder error while receiving";
@@ -978,6 +1392,11 @@ void decode_recv(
      return;
   }
 
+  // Set if the mailbox of the receiver of a message is full and
+  // applies backpressure, in which case we stop reading from the
+  // socket until it has room.
+  Option<Future<Nothing>> backpressure = None();
+
   if (!requests.empty()) {
     // Get the peer address to augment the requests.
     Try<Address> address = socket.peer();
@@ -991,12 +1410,68 @@ void decode_recv(
       return;
     }
 
-    foreach (Request* request, requests) {
+    while (!requests.empty()) {
+      Request* request = requests.front();
+      requests.pop_front();
+
+      // A peer asking to switch to binary message frames waits for
+      // our response before sending anything else, so the request
+      // must be the last one we decoded. Otherwise (or if framing is
+      // disabled) it gets handled like any other HTTP request, i.e.,
+      // the peer gets a response other than '101' and keeps using
+      // HTTP.
+      if (libprocess_flags->enable_message_framing &&
+          requests.empty() &&
+          upgrade(*request)) {
+        VLOG(2) << "Switching connection from " << address.get()
+                << " to binary message frames";
+
+        delete request;
+        delete decoder;
+
+        socket_manager->send(
+            new DataEncoder(
+                "HTTP/1.1 101 Switching Protocols\r\n"
+                "Connection: Upgrade\r\n"
+                "Upgrade: " + string(MESSAGE_FRAMING_PROTOCOL) + "\r\n"
+                "\r\n"),
+            true,
+            socket);
+
+        socket.recv(data, size)
+          .onAny(lambda::bind(
+              &decode_frames_recv,
+              lambda::_1,
+              data,
+              size,
+              socket,
+              new MessageFrameDecoder(__address__)));
+        return;
+      }
+
       request->client = address.get();
-      process_manager->handle(socket, request);
+
+      Option<Future<Nothing>> room = process_manager->handle(socket, request);
+      if (room.isSome()) {
+        backpressure = room;
+      }
     }
   }
 
+  // See `decode_frames_recv`.
+  if (backpressure.isSome() && backpressure->isPending()) {
+    VLOG(2) << "Pausing reading requests until the mailbox of the"
+            << " receiver has room";
+
+    backpressure->onAny([=]() {
+      socket.recv(data, size)
+        .onAny(lambda::bind(
+            &decode_recv, lambda::_1, data, size, socket, decoder));
+    });
+
+    return;
+  }
+
   socket.recv(data, size)
     .onAny(lambda::bind(&decode_recv, lambda::_1, data, size, socket, decoder));
 }
@@ -1092,6 +1567,63 @@ void install(vector<Owned<FirewallRule>>&& rules)
 } // namespace firewall {
 
 
+// Returns the number of event loops to run, which defaults to one.
+//
+// Operators can shard socket I/O across multiple event loop threads
+// using an environment variable. This is useful for processes that
+// manage a very large number of connections (e.g., a master with tens
+// of thousands of agents) where a single event loop thread saturates
+// before the worker threads do.
+static size_t num_event_loops()
+{
+  size_t num_event_loops = 1;
+
+  constexpr char env_var[] = "LIBPROCESS_NUM_EVENT_LOOPS";
+  Option<string> value = os::getenv(env_var);
+  if (value.isSome()) {
+    constexpr long maxval = 64;
+    Try<long> number = numify<long>(value.get().c_str());
+    if (number.isSome() && number.get() > 0L && number.get() <= maxval) {
+      VLOG(1) << "Overriding default number of event loops "
+              << num_event_loops << ", using the value "
+              << env_var << "=" << number.get() << " instead";
+      num_event_loops = number.get();
+    } else {
+      LOG(WARNING) << "Ignoring invalid value " << value.get()
+                   << " for " << env_var
+                   << ", using default value " << num_event_loops
+                   << ". Valid values are integers in the range 1 to "
+                   << maxval;
+    }
+  }
+
+  return num_event_loops;
+}
+
+
+#ifdef USE_IO_URING
+// Whether the event loops should do their I/O with io_uring. Like the
+// number of event loops this needs to be known before the flags get
+// loaded, since the event loops get started first.
+static bool enable_io_uring()
+{
+  constexpr char env_var[] = "LIBPROCESS_ENABLE_IO_URING";
+  Option<string> value = os::getenv(env_var);
+  if (value.isSome()) {
+    Try<bool> enable = flags::parse<bool>(value.get());
+    if (enable.isSome()) {
+      return enable.get();
+    }
+
+    LOG(WARNING) << "Ignoring invalid value " << value.get()
+                 << " for " << env_var << ": " << enable.error();
+  }
+
+  return false;
+}
+#endif // USE_IO_URING
+
+
 // Tests can declare this function and use it to re-configure libprocess
 // programmatically. Without explicitly declaring this function, it
 // is not visible. This is the preferred behavior as we do not want
@@ -1202,8 +1734,12 @@ bool initialize(
   process_manager = new ProcessManager(delegate);
   socket_manager = new SocketManager();
 
-  // Initialize the event loop.
-  EventLoop::initialize();
+  // Initialize the event loop(s).
+  EventLoop::initialize(num_event_loops());
+
+#ifdef USE_IO_URING
+  io_uring::initialize(enable_io_uring());
+#endif // USE_IO_URING
 
   // Setup processing threads.
   long num_worker_threads = process_manager->init_threads();
@@ -1225,6 +1761,10 @@ bool initialize(
     LOG(WARNING) << warning.message;
   }
 
+  HttpCompression::level = libprocess_flags->http_compression_level;
+  HttpCompression::minimum =
+    libprocess_flags->http_compression_min_size.bytes();
+
   uint16_t port = 0;
 
   if (libprocess_flags->port.isSome()) {
@@ -1337,6 +1877,7 @@ bool initialize(
   //   |--logging
   //   |--profiler
   //   |--processesRoute
+  //   |--socketsRoute
   //
   //   authenticator_manager
 
@@ -1348,6 +1889,14 @@ bool initialize(
       metrics::internal::MetricsProcess::create(readonlyAuthenticationRealm),
       true);
 
+  // Create (or re-add) the metrics of the `HttpProxy`s.
+  if (http_proxy_metrics == nullptr) {
+    http_proxy_metrics = new HttpProxyMetrics();
+  }
+
+  metrics::add(http_proxy_metrics->pipelined_requests);
+  metrics::add(http_proxy_metrics->pipelining_depth);
+
   // Create the global logging process.
   _logging = spawn(new Logging(readwriteAuthenticationRealm), true);
 
@@ -1379,8 +1928,25 @@ bool initialize(
 
   processes_route = new Route("/__processes__", None(), __processes__);
 
+  // Add a route for getting socket information.
+  lambda::function<Future<Response>(const Request&)> __sockets__ =
+    lambda::bind(&SocketManager::__sockets__, socket_manager, lambda::_1);
+
+  sockets_route = new Route("/__sockets__", None(), __sockets__);
+
+  // Add a route for getting process statistics.
+  lambda::function<Future<Response>(const Request&)> __process_statistics__ =
+    lambda::bind(
+        &ProcessManager::__process_statistics__,
+        process_manager,
+        lambda::_1);
+
+  process_statistics_route = new Route(
+      "/__process_statistics__", None(), __process_statistics__);
+
   VLOG(1) << "libprocess is initialized on " << address() << " with "
-          << num_worker_threads << " worker threads";
+          << num_worker_threads << " worker threads and "
+          << EventLoop::loops() << " event loop(s)";
 
   // Return `true` to indicate that this was the first invocation of
   // `process::initialize()`.
@@ -1403,6 +1969,12 @@ void finalize(bool finalize_wsa)
   delete processes_route;
   processes_route = nullptr;
 
+  delete sockets_route;
+  sockets_route = nullptr;
+
+  delete process_statistics_route;
+  process_statistics_route = nullptr;
+
   // Close the server socket.
   // This will prevent any further connections managed by the `SocketManager`.
   synchronized (socket_mutex) {
@@ -1455,6 +2027,12 @@ void finalize(bool finalize_wsa)
   delete process_manager;
   process_manager = nullptr;
 
+#ifdef USE_IO_URING
+  // NOTE: This cancels any operations that are still in progress,
+  // e.g., for sockets that got closed after the event loops stopped.
+  io_uring::finalize();
+#endif // USE_IO_URING
+
   // Clear the public address of the server socket.
   // NOTE: This variable is necessary for process communication, so it
   // cannot be cleared until after the `ProcessManager` is deleted.
@@ -1539,6 +2117,8 @@ void HttpProxy::finalize()
 
     items.pop();
     delete item;
+
+    --http_proxy_metrics->pipelined_requests;
   }
 
   // Just in case this process gets killed outside of `SocketManager::close`,
@@ -1557,43 +2137,49 @@ void HttpProxy::handle(const Future<Response>& future, const Request& request)
 {
   items.push(new Item(request, future));
 
-  if (items.size() == 1) {
-    next();
+  ++http_proxy_metrics->pipelined_requests;
+  http_proxy_metrics->pipelining_depth = items.size();
+
+  // Wait for any transition of the future right away rather than
+  // once the responses before it have been sent, so that we can send
+  // it as soon as it is its turn.
+  if (future.isPending()) {
+    future.onAny(defer(self(), &HttpProxy::waited, lambda::_1));
   }
+
+  next();
 }
 
 
 void HttpProxy::next()
 {
-  if (items.size() > 0) {
-    // Wait for any transition of the future.
-    items.front()->future.onAny(
-        defer(self(), &HttpProxy::waited, lambda::_1));
+  // NOTE: A response that is not pending anymore might get sent
+  // before we get to `waited` for it, so `waited` can be invoked
+  // after its item is gone.
+  while (pipe.isNone() &&
+         !items.empty() &&
+         !items.front()->future.isPending()) {
+    Item* item = items.front();
+    items.pop();
+
+    process(item->future, item->request);
+
+    delete item;
+
+    --http_proxy_metrics->pipelined_requests;
   }
 }
 
 
 void HttpProxy::waited(const Future<Response>& future)
 {
-  CHECK(items.size() > 0);
-  Item* item = items.front();
+  CHECK(!future.isPending());
 
-  CHECK(future == item->future);
-
-  // Process the item and determine if we're done or not (so we know
-  // whether to start waiting on the next responses).
-  bool processed = process(item->future, item->request);
-
-  items.pop();
-  delete item;
-
-  if (processed) {
-    next();
-  }
+  next();
 }
 
 
-bool HttpProxy::process(const Future<Response>& future, const Request& request)
+void HttpProxy::process(const Future<Response>& future, const Request& request)
 {
   if (!future.isReady()) {
     // TODO(benh): Consider handling other "states" of future
@@ -1611,7 +2197,7 @@ bool HttpProxy::process(const Future<Response>& future, const Request& request)
 
     socket_manager->send(response, request, socket);
 
-    return true; // All done, can process next response.
+    return;
   }
 
   Response response = future.get();
@@ -1658,7 +2244,7 @@ bool HttpProxy::process(const Future<Response>& future, const Request& request)
 
         if (s.st_size == 0) {
           socket_manager->send(response, request, socket);
-          return true; // All done, can process next request.
+          return;
         }
 
         VLOG(1) << "Sending file at '" << path << "' with length " << s.st_size;
@@ -1686,6 +2272,18 @@ bool HttpProxy::process(const Future<Response>& future, const Request& request)
     // header, we fill in (or overwrite) 'Transfer-Encoding' header.
     response.headers["Transfer-Encoding"] = "chunked";
 
+    // Compress the chunks if the response asks for it and the client
+    // accepts it (see `stream`).
+    Option<string> encoding = None();
+    if (response.compress && !response.headers.contains("Content-Encoding")) {
+      encoding = HttpCompression::encoding(request);
+    }
+
+    if (encoding.isSome()) {
+      response.headers["Content-Encoding"] = encoding.get();
+      compressor = HttpCompression::compressor(encoding.get());
+    }
+
     VLOG(3) << "Starting \"chunked\" streaming";
 
     socket_manager->send(
@@ -1706,13 +2304,9 @@ bool HttpProxy::process(const Future<Response>& future, const Request& request)
 
     reader.read()
       .onAny(defer(self(), &Self::stream, request_, lambda::_1));
-
-    return false; // Streaming, don't process next response (yet)!
   } else {
     socket_manager->send(response, request, socket);
   }
-
-  return true; // All done, can process next response.
 }
 
 
@@ -1727,18 +2321,32 @@ void HttpProxy::stream(
 
   bool finished = false; // Whether we're done streaming.
 
-  if (chunk.isReady()) {
+  // When compressing, every chunk is flushed by the compressor so the
+  // client can decompress it right away. Once we finished reading, the
+  // compressor still needs to write the end of the compressed stream.
+  Try<string> data = chunk.isReady() ? chunk.get() : string();
+
+  if (chunk.isReady() && compressor.get() != nullptr) {
+    data = chunk->empty()
+      ? compressor->finish()
+      : compressor->compress(chunk.get());
+  }
+
+  if (chunk.isReady() && data.isSome()) {
     std::ostringstream out;
 
+    // NOTE: An empty chunk would mark the end of the response.
+    if (!data->empty()) {
+      out << std::hex << data->size() << "\r\n";
+      out << data.get();
+      out << "\r\n";
+    }
+
     if (chunk.get().empty()) {
       // Finished reading.
       out << "0\r\n" << "\r\n";
       finished = true;
     } else {
-      out << std::hex << chunk.get().size() << "\r\n";
-      out << chunk.get();
-      out << "\r\n";
-
       // Keep reading.
       reader.read()
         .onAny(defer(self(), &Self::stream, request, lambda::_1));
@@ -1749,6 +2357,11 @@ void HttpProxy::stream(
         new DataEncoder(out.str()),
         finished ? request->keepAlive : true,
         socket);
+  } else if (chunk.isReady()) {
+    VLOG(1) << "Failed to compress stream: " << data.error();
+    // TODO(bmahler): Have to close connection if headers were sent!
+    socket_manager->send(InternalServerError(), *request, socket);
+    finished = true;
   } else if (chunk.isFailed()) {
     VLOG(1) << "Failed to read from stream: " << chunk.failure();
     // TODO(bmahler): Have to close connection if headers were sent!
@@ -1764,6 +2377,7 @@ void HttpProxy::stream(
   if (finished) {
     reader.close();
     pipe = None();
+    compressor.reset();
     next();
   }
 }
@@ -1842,6 +2456,53 @@ void ignore_recv_data(
 }
 
 
+// Receives the peer's response to our request to switch a link to
+// binary message frames. Only the status line matters: a '101' means
+// the peer switched, anything else (e.g., a '404' from an older
+// version of libprocess) means we keep using HTTP. Everything after
+// the status line is ignored.
+void negotiate_recv(
+    const Future<size_t>& length,
+    Socket socket,
+    char* data,
+    size_t size,
+    string* response)
+{
+  if (length.isDiscarded() || length.isFailed() || length.get() == 0) {
+    socket_manager->close(socket);
+    delete[] data;
+    delete response;
+    return;
+  }
+
+  response->append(data, length.get());
+
+  size_t index = response->find("\r\n");
+  if (index == string::npos) {
+    socket.recv(data, size)
+      .onAny(lambda::bind(
+          &negotiate_recv, lambda::_1, socket, data, size, response));
+    return;
+  }
+
+  // The status line looks like 'HTTP/1.1 101 Switching Protocols'.
+  vector<string> tokens =
+    strings::tokenize(response->substr(0, index), " ", 3);
+
+  bool framing = tokens.size() >= 2 && tokens[1] == "101";
+
+  delete response;
+
+  VLOG(2) << "Peer " << (framing ? "agreed" : "declined")
+          << " to switch link to binary message frames";
+
+  socket_manager->negotiated(socket, framing);
+
+  socket.recv(data, size)
+    .onAny(lambda::bind(&ignore_recv_data, lambda::_1, socket, data, size));
+}
+
+
 // Forward declaration.
 void send(Encoder* encoder, Socket socket);
 
@@ -1926,17 +2587,41 @@ void SocketManager::link_connect(
     if (sockets.count(socket) <= 0) {
       return;
     }
-
-    size_t size = 80 * 1024;
-    char* data = new char[size];
-
-    socket.recv(data, size)
-      .onAny(lambda::bind(
-          &internal::ignore_recv_data,
-          lambda::_1,
-          socket,
-          data,
-          size));
+
+    size_t size = 80 * 1024;
+    char* data = new char[size];
+
+    if (negotiating.count(socket) > 0) {
+      // Ask the peer to switch this link to binary message frames.
+      // Any messages sent in the meantime wait in 'negotiating' until
+      // `negotiate_recv` gets the response, so this request is the
+      // only thing in the 'outgoing' queue.
+      CHECK(outgoing.count(socket) > 0 && outgoing[socket].empty());
+
+      outgoing[socket].push(new DataEncoder(
+          "GET /__message_framing__ HTTP/1.1\r\n"
+          "Host: \r\n"
+          "Connection: Upgrade\r\n"
+          "Upgrade: " + string(MESSAGE_FRAMING_PROTOCOL) + "\r\n"
+          "\r\n"));
+
+      socket.recv(data, size)
+        .onAny(lambda::bind(
+            &internal::negotiate_recv,
+            lambda::_1,
+            socket,
+            data,
+            size,
+            new string()));
+    } else {
+      socket.recv(data, size)
+        .onAny(lambda::bind(
+            &internal::ignore_recv_data,
+            lambda::_1,
+            socket,
+            data,
+            size));
+    }
   }
 
   // In order to avoid a race condition where internal::send() is
@@ -2014,6 +2699,10 @@ void SocketManager::link(
         // connected.
         outgoing[s];
 
+        if (libprocess_flags->enable_message_framing) {
+          negotiating[s];
+        }
+
         connect = true;
       } else if (remote == ProcessBase::RemoteConnection::RECONNECT) {
         // There is a persistent link already and the linker wants to
@@ -2038,6 +2727,15 @@ void SocketManager::link(
         Socket existing(sockets.at(persists.at(to.address)));
         swap_implementing_socket(existing, socket.get());
 
+        // We can only negotiate binary message frames if nothing
+        // encoded as HTTP is queued for the new socket, since the
+        // request to switch must be the first thing we send.
+        int_fd s = socket.get().get();
+        if (libprocess_flags->enable_message_framing &&
+            outgoing[s].empty()) {
+          negotiating[s];
+        }
+
         // The `existing` socket could be a perfectly functional socket.
         // In this case, the socket may be referenced in the callback
         // loop of `internal::ignore_recv_data`. We shutdown the socket
@@ -2152,19 +2850,44 @@ void _send(
     size_t size);
 
 
+void _send_batch(
+    const Future<size_t>& result,
+    Socket socket,
+    const vector<DataEncoder*>& batch,
+    const vector<pair<const char*, size_t>>& buffers);
+
+
+// Sends the data of 'batch' along with any other data encoders that
+// are queued for the socket (see `SocketManager::coalesce`), using a
+// single send where possible rather than one per encoder.
+void send(vector<DataEncoder*>&& batch, Socket socket)
+{
+  socket_manager->coalesce(socket, &batch);
+
+  vector<pair<const char*, size_t>> buffers;
+  buffers.reserve(batch.size());
+
+  foreach (DataEncoder* encoder, batch) {
+    size_t size;
+    const char* data = encoder->next(&size);
+    buffers.emplace_back(data, size);
+  }
+
+  Future<size_t> sent = buffers.size() == 1
+    ? socket.send(buffers.front().first, buffers.front().second)
+    : socket.send(buffers);
+
+  sent.onAny([socket, batch, buffers](const Future<size_t>& length) {
+    _send_batch(length, socket, batch, buffers);
+  });
+}
+
+
 void send(Encoder* encoder, Socket socket)
 {
   switch (encoder->kind()) {
     case Encoder::DATA: {
-      size_t size;
-      const char* data = static_cast<DataEncoder*>(encoder)->next(&size);
-      socket.send(data, size)
-        .onAny(lambda::bind(
-            &internal::_send,
-            lambda::_1,
-            socket,
-            encoder,
-            size));
+      send(vector<DataEncoder*>{static_cast<DataEncoder*>(encoder)}, socket);
       break;
     }
     case Encoder::FILE: {
@@ -2212,6 +2935,56 @@ void _send(
   }
 }
 
+
+void _send_batch(
+    const Future<size_t>& length,
+    Socket socket,
+    const vector<DataEncoder*>& batch,
+    const vector<pair<const char*, size_t>>& buffers)
+{
+  CHECK_EQ(batch.size(), buffers.size());
+
+  if (length.isDiscarded() || length.isFailed()) {
+    socket_manager->close(socket);
+
+    foreach (DataEncoder* encoder, batch) {
+      delete encoder;
+    }
+
+    return;
+  }
+
+  // Update each encoder with the amount sent, in order, and keep the
+  // encoders that still have data to send.
+  vector<DataEncoder*> remaining;
+
+  size_t sent = length.get();
+
+  for (size_t i = 0; i < batch.size(); i++) {
+    const size_t size = std::min(sent, buffers[i].second);
+    sent -= size;
+
+    batch[i]->backup(buffers[i].second - size);
+
+    if (batch[i]->remaining() == 0) {
+      delete batch[i];
+    } else {
+      remaining.push_back(batch[i]);
+    }
+  }
+
+  if (!remaining.empty()) {
+    send(std::move(remaining), socket);
+    return;
+  }
+
+  // Check for more stuff to send on socket.
+  Encoder* next = socket_manager->next(socket);
+  if (next != nullptr) {
+    send(next, socket);
+  }
+}
+
 } // namespace internal {
 
 
@@ -2354,6 +3127,7 @@ void SocketManager::send(Message&& message, const SocketImpl::Kind& kind)
   const Address& address = message.to.address;
 
   Option<Socket> socket = None();
+  Encoder* encoder = nullptr;
   bool connect = false;
 
   synchronized (mutex) {
@@ -2371,8 +3145,20 @@ void SocketManager::send(Message&& message, const SocketImpl::Kind& kind)
         dispose.insert(socket.get());
       }
 
+      // Hold on to the message until we know how to encode it.
+      if (negotiating.count(s) > 0) {
+        negotiating[s].push(std::move(message));
+        return;
+      }
+
+      if (framed.count(s) > 0) {
+        encoder = new MessageFrameEncoder(message);
+      } else {
+        encoder = new MessageEncoder(message);
+      }
+
       if (outgoing.count(socket.get()) > 0) {
-        outgoing[socket.get()].push(new MessageEncoder(message));
+        outgoing[socket.get()].push(encoder);
         return;
       } else {
         // Initialize the outgoing queue.
@@ -2420,7 +3206,7 @@ void SocketManager::send(Message&& message, const SocketImpl::Kind& kind)
   } else {
     // If we're not connecting and we haven't added the encoder to
     // the 'outgoing' queue then schedule it to be sent.
-    internal::send(new MessageEncoder(message), socket.get());
+    internal::send(CHECK_NOTNULL(encoder), socket.get());
   }
 }
 
@@ -2472,6 +3258,7 @@ Encoder* SocketManager::next(int_fd s)
           }
 
           dispose.erase(s);
+          statistics.erase(s);
 
           auto iterator = sockets.find(s);
 
@@ -2510,6 +3297,134 @@ Encoder* SocketManager::next(int_fd s)
 }
 
 
+void SocketManager::coalesce(
+    const Socket& socket,
+    vector<DataEncoder*>* batch)
+{
+  CHECK(!batch->empty());
+
+  synchronized (mutex) {
+    // Like `SocketManager::next`, we don't assume the socket is still
+    // active, in which case we just send what we were given.
+    if (sockets.count(socket) == 0) {
+      return;
+    }
+
+    Bytes bytes;
+    foreach (DataEncoder* encoder, *batch) {
+      bytes += Bytes(encoder->remaining());
+    }
+
+    if (outgoing.count(socket) > 0) {
+      queue<Encoder*>& encoders = outgoing[socket];
+
+      // We stop at the first encoder that isn't a `DataEncoder`
+      // (e.g., a `FileEncoder`) to preserve the order of the data.
+      while (!encoders.empty() &&
+             encoders.front()->kind() == Encoder::DATA &&
+             batch->size() < libprocess_flags->send_batch_max_buffers &&
+             bytes + Bytes(encoders.front()->remaining()) <=
+               libprocess_flags->send_batch_max_bytes) {
+        bytes += Bytes(encoders.front()->remaining());
+        batch->push_back(static_cast<DataEncoder*>(encoders.front()));
+        encoders.pop();
+      }
+    }
+
+    SendStatistics& statistics = this->statistics[socket];
+    statistics.sends++;
+    statistics.buffers += batch->size();
+    statistics.bytes += bytes.bytes();
+    statistics.max_buffers = std::max(
+        statistics.max_buffers,
+        static_cast<uint64_t>(batch->size()));
+  }
+}
+
+
+Future<Response> SocketManager::__sockets__(const Request&)
+{
+  JSON::Array array;
+
+  synchronized (mutex) {
+    foreachpair (int_fd s, const Socket& socket, sockets) {
+      JSON::Object object;
+
+      Try<Address> peer = socket.peer();
+      if (peer.isSome()) {
+        object.values["peer"] = stringify(peer.get());
+      }
+
+      // Outbound sockets are either links or temporary sockets.
+      Option<Address> address = addresses.get(s);
+      if (address.isSome()) {
+        object.values["link"] =
+          persists.count(address.get()) > 0 && persists.at(address.get()) == s;
+      }
+
+      const SendStatistics statistics =
+        this->statistics.get(s).getOrElse(SendStatistics());
+
+      object.values["sends"] = statistics.sends;
+      object.values["send_buffers"] = statistics.buffers;
+      object.values["send_bytes"] = statistics.bytes;
+      object.values["max_send_buffers"] = statistics.max_buffers;
+
+      array.values.push_back(object);
+    }
+  }
+
+  return OK(array);
+}
+
+
+void SocketManager::negotiated(const Socket& socket, bool framing)
+{
+  Encoder* encoder = nullptr; // Non-null if we need to start sending.
+
+  synchronized (mutex) {
+    // The socket may have been closed or swapped out (see
+    // `swap_implementing_socket`) while we waited for the peer.
+    if (sockets.count(socket) <= 0 || negotiating.count(socket) <= 0) {
+      return;
+    }
+
+    if (framing) {
+      framed.insert(socket);
+    }
+
+    queue<Message>& messages = negotiating.at(socket);
+
+    if (!messages.empty()) {
+      // If nothing is being sent on the socket right now we need to
+      // initialize the 'outgoing' queue and start sending ourselves.
+      bool start = outgoing.count(socket) == 0;
+
+      while (!messages.empty()) {
+        if (framing) {
+          outgoing[socket].push(new MessageFrameEncoder(messages.front()));
+        } else {
+          outgoing[socket].push(new MessageEncoder(messages.front()));
+        }
+
+        messages.pop();
+      }
+
+      if (start) {
+        encoder = outgoing[socket].front();
+        outgoing[socket].pop();
+      }
+    }
+
+    negotiating.erase(socket);
+  }
+
+  if (encoder != nullptr) {
+    internal::send(encoder, socket);
+  }
+}
+
+
 void SocketManager::close(int_fd s)
 {
   Option<UPID> proxy; // Some if an `HttpProxy` needs to be terminated.
@@ -2532,6 +3447,10 @@ void SocketManager::close(int_fd s)
         outgoing.erase(s);
       }
 
+      negotiating.erase(s);
+      framed.erase(s);
+      statistics.erase(s);
+
       // Clean up after sockets used for remote communication.
       Option<Address> address = addresses.get(s);
       if (address.isSome()) {
@@ -2747,10 +3666,54 @@ void SocketManager::swap_implementing_socket(
       // No need to erase as we're changing the value, not the key.
     }
 
+    // The new socket has to negotiate binary message frames again
+    // (see `SocketManager::link`), so messages waiting for the old
+    // socket to finish negotiating now wait for the new socket. The
+    // old socket's request to switch is dropped if it hasn't been
+    // sent yet since the new socket sends its own.
+    if (negotiating.count(from_fd) > 0) {
+      negotiating[to_fd] = std::move(negotiating[from_fd]);
+      negotiating.erase(from_fd);
+
+      while (!outgoing[from_fd].empty()) {
+        delete outgoing[from_fd].front();
+        outgoing[from_fd].pop();
+      }
+    }
+
+    // Likewise, frames queued for the old socket can't be sent until
+    // the new socket has negotiated, so we turn them back into
+    // messages.
+    if (framed.count(from_fd) > 0) {
+      MessageFrameDecoder decoder(address.get());
+
+      while (!outgoing[from_fd].empty()) {
+        DataEncoder* encoder =
+          static_cast<DataEncoder*>(outgoing[from_fd].front());
+        outgoing[from_fd].pop();
+
+        size_t size;
+        const char* data = encoder->next(&size);
+
+        foreach (Message* message, decoder.decode(data, size)) {
+          negotiating[to_fd].push(std::move(*message));
+          delete message;
+        }
+
+        delete encoder;
+      }
+
+      CHECK(!decoder.failed());
+
+      framed.erase(from_fd);
+    }
+
     // Move any encoders queued against this link to the new socket.
     outgoing[to_fd] = std::move(outgoing[from_fd]);
     outgoing.erase(from_fd);
 
+    statistics.erase(from_fd);
+
     // Update the fd any proxies are associated with.
     if (proxies.count(from_fd) > 0) {
       proxies[to_fd] = proxies[from_fd];
@@ -2862,7 +3825,29 @@ long ProcessManager::init_threads()
                        << runq.capacity() << " at this time";
   }
 
-  threads.reserve(num_worker_threads + 1);
+#ifdef WORK_STEALING_RUN_QUEUE
+  // We allow the operator to ask that a process be preferentially run
+  // on the worker thread that last ran it (rather than the worker
+  // that enqueued it) which can improve cache locality for processes
+  // that mostly receive events from other threads (e.g., sockets).
+  bool affinity = false;
+
+  constexpr char affinity_env_var[] = "LIBPROCESS_WORKER_AFFINITY";
+  value = os::getenv(affinity_env_var);
+  if (value.isSome()) {
+    Try<bool> parse = flags::parse<bool>(value.get());
+    if (parse.isSome()) {
+      affinity = parse.get();
+    } else {
+      LOG(WARNING) << "Ignoring invalid value " << value.get()
+                   << " for " << affinity_env_var << ": " << parse.error();
+    }
+  }
+
+  runq.initialize(num_worker_threads, affinity);
+#endif // WORK_STEALING_RUN_QUEUE
+
+  threads.reserve(num_worker_threads + EventLoop::loops());
 
   // Create processing threads.
   for (long i = 0; i < num_worker_threads; i++) {
@@ -2889,8 +3874,10 @@ long ProcessManager::init_threads()
         }));
   }
 
-  // Create a thread for the event loop.
-  threads.emplace_back(new std::thread(&EventLoop::run));
+  // Create a thread for each event loop.
+  for (size_t i = 0; i < EventLoop::loops(); i++) {
+    threads.emplace_back(new std::thread(&EventLoop::run, i));
+  }
 
   return num_worker_threads;
 }
@@ -2917,7 +3904,7 @@ ProcessReference ProcessManager::use(const UPID& pid)
 }
 
 
-void ProcessManager::handle(
+Option<Future<Nothing>> ProcessManager::handle(
     const Socket& socket,
     Request* request)
 {
@@ -2940,19 +3927,27 @@ void ProcessManager::handle(
 
     // Cleanup request.
     delete request;
-    return;
+    return None();
   }
 
   // Check if this is a libprocess request (i.e., 'User-Agent:
   // libprocess/id@ip:port') and if so, parse as a message.
-  if (libprocess(request)) {
+  if (libprocess(*request)) {
     // It is guaranteed that the continuation would run before the next
     // request arrives. Also, it's fine to pass the `this` pointer to the
     // continuation as this would get executed synchronously (if still pending)
     // from `SocketManager::finalize()` due to it closing all active sockets
     // during libprocess finalization.
-    parse(*request)
-      .onAny([socket, request](const Future<MessageEvent*>& future) {
+    //
+    // NOTE: backpressure is only applied if the continuation runs
+    // right away, i.e., unless the body of the message is streamed
+    // (compressed), since we might need to read more of the body.
+    std::shared_ptr<Option<Future<Nothing>>> backpressure(
+        new Option<Future<Nothing>>());
+
+    parse(request)
+      .onAny([socket, request, backpressure](
+          const Future<MessageEvent*>& future) {
         // Get the HttpProxy pid for this socket.
         PID<HttpProxy> proxy = socket_manager->proxy(socket);
 
@@ -3002,7 +3997,8 @@ void ProcessManager::handle(
 
         // TODO(benh): Use the sender PID when delivering in order to
         // capture happens-before timing relationships for testing.
-        bool accepted = process_manager->deliver(event->message.to, event);
+        bool accepted = process_manager->deliver(
+            event->message.to, event, nullptr, backpressure.get());
 
         // NOTE: prior to commit d5fe51c on April 11, 2014 we needed
         // to ignore sending responses in the event the receiver was a
@@ -3021,7 +4017,7 @@ void ProcessManager::handle(
         return;
       });
 
-    return;
+    return *backpressure;
   }
 
   // Treat this as an HTTP request.
@@ -3040,7 +4036,7 @@ void ProcessManager::handle(
 
     // Cleanup request.
     delete request;
-    return;
+    return None();
   }
 
   // Split the path by '/'.
@@ -3091,7 +4087,7 @@ void ProcessManager::handle(
 
         // Cleanup request.
         delete request;
-        return;
+        return None();
       }
     }
   }
@@ -3111,7 +4107,7 @@ void ProcessManager::handle(
     // happens-before timing relationships for testing.
     deliver(receiver, new HttpEvent(request, promise));
 
-    return;
+    return None();
   }
 
   // This has no receiver, send error response.
@@ -3126,16 +4122,49 @@ void ProcessManager::handle(
 
   // Cleanup request.
   delete request;
+
+  return None();
 }
 
 
 bool ProcessManager::deliver(
     ProcessBase* receiver,
     Event* event,
-    ProcessBase* sender)
+    ProcessBase* sender,
+    Option<Future<Nothing>>* backpressure)
 {
   CHECK(event != nullptr);
 
+  if (receiver->mailbox && event->is<MessageEvent>()) {
+    const Message& message = event->as<MessageEvent>().message;
+
+    Option<ProcessBase::Overflow> overflow =
+      receiver->mailbox->admit(message.name, backpressure);
+
+    if (overflow.isSome()) {
+      VLOG(2) << "Dropping message '" << message.name << "' from "
+              << message.from << " since the mailbox of " << receiver->pid
+              << " is full";
+
+      // NOTE: we never reject a rejection to not bounce messages back
+      // and forth between two full mailboxes.
+      if (overflow.get() == ProcessBase::Overflow::REJECT &&
+          message.from &&
+          message.name != ProcessBase::MAILBOX_FULL) {
+        transport(
+            receiver->pid,
+            message.from,
+            ProcessBase::MAILBOX_FULL,
+            message.name.data(),
+            message.name.size(),
+            receiver);
+      }
+
+      delete event;
+      return true;
+    }
+  }
+
   // If we are using a manual clock then update the current time of
   // the receiver using the sender if necessary to preserve the
   // happens-before relationship between the sender and receiver. Note
@@ -3156,12 +4185,13 @@ bool ProcessManager::deliver(
 bool ProcessManager::deliver(
     const UPID& to,
     Event* event,
-    ProcessBase* sender)
+    ProcessBase* sender,
+    Option<Future<Nothing>>* backpressure)
 {
   CHECK(event != nullptr);
 
   if (ProcessReference receiver = use(to)) {
-    return deliver(receiver, event, sender);
+    return deliver(receiver, event, sender, backpressure);
   }
 
   VLOG(2) << "Dropping event for process " << to;
@@ -3171,6 +4201,72 @@ bool ProcessManager::deliver(
 }
 
 
+// Returns the metrics for the statistics of a process. The gauges
+// only hold on to the statistics, not the process, so they remain
+// safe to evaluate while the process is being cleaned up.
+static vector<metrics::Gauge> gauges(
+    const UPID& pid,
+    const std::shared_ptr<ProcessStatistics>& statistics)
+{
+  const string prefix = "libprocess/processes/" + pid.id + "/";
+
+  vector<metrics::Gauge> gauges = {
+    metrics::Gauge(prefix + "events_enqueued", [statistics]() {
+      return static_cast<double>(statistics->events_enqueued());
+    }),
+    metrics::Gauge(prefix + "event_queue_size", [statistics]() {
+      return static_cast<double>(statistics->event_queue_size());
+    }),
+    metrics::Gauge(prefix + "event_queue_max_size", [statistics]() {
+      return static_cast<double>(statistics->event_queue_max_size());
+    }),
+    metrics::Gauge(prefix + "event_queue_time_max_ms", [statistics]() {
+      return statistics->event_queue_max_time().ms();
+    })
+  };
+
+  for (int i = 0; i < ProcessStatistics::TYPES; i++) {
+    const ProcessStatistics::Type type = static_cast<ProcessStatistics::Type>(i);
+
+    gauges.push_back(metrics::Gauge(
+        prefix + ProcessStatistics::name(type) + "_handler_time_ms",
+        [statistics, type]() {
+          return statistics->handler_time(type).ms();
+        }));
+  }
+
+  return gauges;
+}
+
+
+// Returns the metrics for the mailbox limit of a process, see
+// `gauges` above.
+static vector<metrics::Gauge> gauges(
+    const UPID& pid,
+    const std::shared_ptr<Mailbox>& mailbox)
+{
+  const string prefix = "libprocess/processes/" + pid.id + "/mailbox/";
+
+  return {
+    metrics::Gauge(prefix + "limit", [mailbox]() {
+      return static_cast<double>(mailbox->limit());
+    }),
+    metrics::Gauge(prefix + "messages", [mailbox]() {
+      return static_cast<double>(mailbox->messages());
+    }),
+    metrics::Gauge(prefix + "dropped", [mailbox]() {
+      return static_cast<double>(mailbox->dropped());
+    }),
+    metrics::Gauge(prefix + "rejected", [mailbox]() {
+      return static_cast<double>(mailbox->rejected());
+    }),
+    metrics::Gauge(prefix + "backpressured", [mailbox]() {
+      return static_cast<double>(mailbox->backpressured());
+    })
+  };
+}
+
+
 UPID ProcessManager::spawn(ProcessBase* process, bool manage)
 {
   CHECK_NOTNULL(process);
@@ -3228,6 +4324,20 @@ UPID ProcessManager::spawn(ProcessBase* process, bool manage)
   // (e.g., when 'manage' is set to true).
   UPID pid = process->self();
 
+  // NOTE: The metrics of processes spawned before the metrics process
+  // itself (during `process::initialize`) are not published.
+  if (process->statistics && metrics::internal::metrics) {
+    foreach (const metrics::Gauge& gauge, gauges(pid, process->statistics)) {
+      metrics::add(gauge);
+    }
+  }
+
+  if (process->mailbox && metrics::internal::metrics) {
+    foreach (const metrics::Gauge& gauge, gauges(pid, process->mailbox)) {
+      metrics::add(gauge);
+    }
+  }
+
   // Add process to the run queue (so 'initialize' will get invoked).
   enqueue(process);
 
@@ -3274,6 +4384,14 @@ void ProcessManager::resume(ProcessBase* process)
 
     if (!process->events->consumer.empty()) {
       event = process->events->consumer.dequeue();
+
+      if (process->statistics) {
+        process->statistics->dequeue(*event);
+      }
+
+      if (process->mailbox && event->is<MessageEvent>()) {
+        process->mailbox->dequeued();
+      }
     } else {
       // We now transition the process to BLOCKED. It's possible that
       // events get enqueued while we're still in the READY state.
@@ -3322,6 +4440,14 @@ void ProcessManager::resume(ProcessBase* process)
           delete event;
           event = process->events->consumer.dequeue();
           CHECK_NOTNULL(event);
+
+          if (process->statistics) {
+            process->statistics->dequeue(*event);
+          }
+
+          if (process->mailbox && event->is<MessageEvent>()) {
+            process->mailbox->dequeued();
+          }
         }
       }
 
@@ -3353,6 +4479,12 @@ void ProcessManager::resume(ProcessBase* process)
       terminate = event->is<TerminateEvent>();
 
       // Now service the event.
+      std::chrono::steady_clock::time_point start;
+
+      if (process->statistics) {
+        start = std::chrono::steady_clock::now();
+      }
+
       try {
         process->serve(*event);
       } catch (const std::exception& e) {
@@ -3365,6 +4497,12 @@ void ProcessManager::resume(ProcessBase* process)
         terminate = true;
       }
 
+      if (process->statistics) {
+        process->statistics->handled(
+            ProcessStatistics::type(*event),
+            std::chrono::steady_clock::now() - start);
+      }
+
       delete event;
     }
   }
@@ -3414,6 +4552,26 @@ void ProcessManager::cleanup(ProcessBase* process)
   // Remove help strings for all installed routes for this process.
   dispatch(help, &Help::remove, process->pid.id);
 
+  if (process->statistics && metrics::internal::metrics) {
+    foreach (const metrics::Gauge& gauge,
+             gauges(process->pid, process->statistics)) {
+      metrics::remove(gauge);
+    }
+  }
+
+  // Connections waiting for room in the mailbox must not wait forever
+  // for a process that is gone.
+  if (process->mailbox) {
+    process->mailbox->close();
+
+    if (metrics::internal::metrics) {
+      foreach (const metrics::Gauge& gauge,
+               gauges(process->pid, process->mailbox)) {
+        metrics::remove(gauge);
+      }
+    }
+  }
+
   // Possible gate non-libprocess threads are waiting at.
   std::shared_ptr<Gate> gate = process->gate;
 
@@ -3644,8 +4802,11 @@ void ProcessManager::enqueue(ProcessBase* process)
 
   // TODO(benh): Check and see if this process has its own thread. If
   // it does, push it on that threads runq, and wake up that thread if
-  // it's not running. Otherwise, check and see which thread this
-  // process was last running on, and put it on that threads runq.
+  // it's not running.
+  //
+  // NOTE: with the work stealing run queue the process is put on the
+  // runq of this thread (or of the thread it last ran on, if worker
+  // affinity is enabled), see run_queue.hpp.
 
   runq.enqueue(process);
 }
@@ -3653,9 +4814,9 @@ void ProcessManager::enqueue(ProcessBase* process)
 
 ProcessBase* ProcessManager::dequeue()
 {
-  // TODO(benh): Remove a process from this thread's runq. If there
-  // are no processes to run, and this is not a dedicated thread, then
-  // steal one from another threads runq.
+  // NOTE: with the work stealing run queue we remove a process from
+  // this thread's runq and if there are no processes to run we steal
+  // one from another thread's runq, see run_queue.hpp.
 
   running.fetch_sub(1);
 
@@ -3764,6 +4925,95 @@ Future<Response> ProcessManager::__processes__(const Request&)
 }
 
 
+Future<Response> ProcessManager::__process_statistics__(
+    const Request& request)
+{
+  if (!libprocess_flags->enable_process_statistics) {
+    return ServiceUnavailable(
+        "Process statistics are not enabled, "
+        "see LIBPROCESS_ENABLE_PROCESS_STATISTICS");
+  }
+
+  // The orders in which the processes can be sorted, busiest first.
+  typedef lambda::function<double(const ProcessStatistics&)> Key;
+
+  const hashmap<string, Key> keys = {
+    {"handler_time", [](const ProcessStatistics& statistics) {
+      return statistics.handler_time().ms();
+    }},
+    {"event_queue_time", [](const ProcessStatistics& statistics) {
+      return statistics.event_queue_mean_time().ms();
+    }},
+    {"event_queue_max_time", [](const ProcessStatistics& statistics) {
+      return statistics.event_queue_max_time().ms();
+    }},
+    {"event_queue_size", [](const ProcessStatistics& statistics) {
+      return static_cast<double>(statistics.event_queue_size());
+    }},
+    {"event_queue_max_size", [](const ProcessStatistics& statistics) {
+      return static_cast<double>(statistics.event_queue_max_size());
+    }},
+    {"enqueue_rate", [](const ProcessStatistics& statistics) {
+      return statistics.enqueue_rate();
+    }}
+  };
+
+  const string sort = request.url.query.get("sort").getOrElse("handler_time");
+
+  if (!keys.contains(sort)) {
+    return BadRequest("Unknown value for 'sort': '" + sort + "'");
+  }
+
+  Option<size_t> limit = None();
+
+  if (request.url.query.contains("limit")) {
+    Try<size_t> value = numify<size_t>(request.url.query.at("limit"));
+    if (value.isError()) {
+      return BadRequest("Failed to parse 'limit': " + value.error());
+    }
+
+    limit = value.get();
+  }
+
+  // NOTE: We read the statistics directly rather than dispatching to
+  // each process (as `__processes__` does) so that processes which
+  // are falling behind don't hold up the response.
+  vector<pair<double, JSON::Object>> statistics;
+
+  synchronized (processes_mutex) {
+    foreachvalue (ProcessBase* process, processes) {
+      if (process->statistics) {
+        JSON::Object object = *process->statistics;
+        object.values["id"] = (const string&) process->pid.id;
+
+        statistics.emplace_back(
+            keys.at(sort)(*process->statistics),
+            std::move(object));
+      }
+    }
+  }
+
+  std::stable_sort(
+      statistics.begin(),
+      statistics.end(),
+      [](const pair<double, JSON::Object>& left,
+         const pair<double, JSON::Object>& right) {
+        return left.first > right.first;
+      });
+
+  JSON::Array array;
+  foreach (const auto& entry, statistics) {
+    if (limit.isSome() && array.values.size() >= limit.get()) {
+      break;
+    }
+
+    array.values.push_back(entry.second);
+  }
+
+  return OK(array);
+}
+
+
 ProcessBase::ProcessBase(const string& id)
   : events(new EventQueue()),
     reference(std::make_shared<ProcessBase*>(this)),
@@ -3775,6 +5025,10 @@ ProcessBase::ProcessBase(const string& id)
   pid.address = __address__;
   pid.addresses.v6 = __address6__;
 
+  if (libprocess_flags->enable_process_statistics) {
+    statistics = std::make_shared<ProcessStatistics>();
+  }
+
   // If using a manual clock, try and set current time of process
   // using happens before relationship between creator (__process__)
   // and createe (this)!
@@ -3791,6 +5045,31 @@ ProcessBase::~ProcessBase()
 }
 
 
+const string ProcessBase::MAILBOX_FULL = "__mailbox_full__";
+
+
+void ProcessBase::limit(size_t capacity, Overflow overflow)
+{
+  CHECK(state.load() == State::BOTTOM)
+    << "The mailbox of process " << pid << " must be limited before it is"
+    << " spawned";
+
+  mailbox = std::make_shared<Mailbox>(capacity, overflow);
+}
+
+
+void ProcessBase::limit(const string& name, Overflow overflow)
+{
+  CHECK(state.load() == State::BOTTOM)
+    << "The mailbox of process " << pid << " must be limited before it is"
+    << " spawned";
+
+  CHECK(mailbox) << "The mailbox of process " << pid << " is not limited";
+
+  mailbox->policy(name, overflow);
+}
+
+
 template <>
 size_t ProcessBase::eventCount<MessageEvent>()
 {
@@ -3848,6 +5127,10 @@ void ProcessBase::enqueue(Event* event)
     case State::BOTTOM:
     case State::READY:
     case State::BLOCKED:
+      if (statistics) {
+        statistics->enqueue(event);
+      }
+
       events->producer.enqueue(event);
       break;
     case State::TERMINATING:
@@ -3929,7 +5212,7 @@ void ProcessBase::visit(const MessageEvent& event)
 
 void ProcessBase::visit(const DispatchEvent& event)
 {
-  (*event.f)(this);
+  event.f(this);
 }
 
 
@@ -4353,12 +5636,12 @@ namespace internal {
 
 void dispatch(
     const UPID& pid,
-    const std::shared_ptr<lambda::function<void(ProcessBase*)>>& f,
+    lambda::function<void(ProcessBase*)>&& f,
     const Option<const std::type_info*>& functionType)
 {
   process::initialize();
 
-  DispatchEvent* event = new DispatchEvent(pid, f, functionType);
+  DispatchEvent* event = new DispatchEvent(pid, std::move(f), functionType);
   process_manager->deliver(pid, event, __process__);
 }
 
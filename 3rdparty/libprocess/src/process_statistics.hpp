@@ -0,0 +1,294 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#ifndef __PROCESS_PROCESS_STATISTICS_HPP__
+#define __PROCESS_PROCESS_STATISTICS_HPP__
+
+#include <atomic>
+#include <chrono>
+
+#include <process/event.hpp>
+
+#include <stout/duration.hpp>
+#include <stout/json.hpp>
+
+namespace process {
+
+// Statistics about the event queue of a process and the time spent
+// handling its events, which libprocess keeps for every process when
+// the `LIBPROCESS_ENABLE_PROCESS_STATISTICS` flag is set (see the
+// `/__process_statistics__` endpoint and the `libprocess/processes/`
+// metrics).
+//
+// The statistics are updated by the producers and the (single)
+// consumer of the event queue but can be read from any thread, so a
+// process that is falling behind can be looked at without having to
+// dispatch to it.
+class ProcessStatistics
+{
+public:
+  enum Type
+  {
+    MESSAGE,
+    DISPATCH,
+    HTTP,
+    EXITED,
+    TERMINATE,
+    TYPES // Number of event types.
+  };
+
+  static Type type(const Event& event)
+  {
+    struct Visitor : EventVisitor
+    {
+      virtual void visit(const MessageEvent&) { type = MESSAGE; }
+      virtual void visit(const DispatchEvent&) { type = DISPATCH; }
+      virtual void visit(const HttpEvent&) { type = HTTP; }
+      virtual void visit(const ExitedEvent&) { type = EXITED; }
+      virtual void visit(const TerminateEvent&) { type = TERMINATE; }
+
+      Type type = TYPES;
+    } visitor;
+
+    event.visit(&visitor);
+
+    return visitor.type;
+  }
+
+  static const char* name(Type type)
+  {
+    switch (type) {
+      case MESSAGE: return "message";
+      case DISPATCH: return "dispatch";
+      case HTTP: return "http";
+      case EXITED: return "exited";
+      case TERMINATE: return "terminate";
+      case TYPES: break;
+    }
+
+    return "unknown";
+  }
+
+  ProcessStatistics()
+    : window(nanoseconds(std::chrono::steady_clock::now().time_since_epoch()))
+  {}
+
+  // Invoked by a producer right _before_ enqueueing the event, since
+  // the consumer might dequeue it right away.
+  void enqueue(Event* event)
+  {
+    event->enqueued = std::chrono::steady_clock::now();
+
+    const uint64_t enqueued =
+      enqueues.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    // Close the current window of the enqueue rate once it's at
+    // least `RATE_WINDOW` long. Only the producer that manages to
+    // move the start of the window computes the rate, the others
+    // just count their events towards the next window.
+    const int64_t now = nanoseconds(event->enqueued.time_since_epoch());
+
+    int64_t start = window.load(std::memory_order_relaxed);
+    if (now - start >= RATE_WINDOW &&
+        window.compare_exchange_strong(
+            start, now, std::memory_order_relaxed)) {
+      const uint64_t count =
+        enqueued - windowEnqueues.exchange(
+            enqueued, std::memory_order_relaxed);
+
+      rate.store(
+          count / Nanoseconds(now - start).secs(),
+          std::memory_order_relaxed);
+    }
+
+    const int64_t size_ = size.fetch_add(1, std::memory_order_relaxed) + 1;
+
+    int64_t max = maxSize.load(std::memory_order_relaxed);
+    while (size_ > max &&
+           !maxSize.compare_exchange_weak(
+               max, size_, std::memory_order_relaxed)) {}
+  }
+
+  // Invoked by the consumer after dequeueing the event.
+  void dequeue(const Event& event)
+  {
+    size.fetch_sub(1, std::memory_order_relaxed);
+
+    const int64_t time = nanoseconds(std::chrono::steady_clock::now() -
+                                     event.enqueued);
+
+    dequeues.fetch_add(1, std::memory_order_relaxed);
+    queueTime.fetch_add(time, std::memory_order_relaxed);
+
+    if (time > maxQueueTime.load(std::memory_order_relaxed)) {
+      maxQueueTime.store(time, std::memory_order_relaxed);
+    }
+  }
+
+  // Invoked by the consumer after handling an event.
+  void handled(Type type, const std::chrono::steady_clock::duration& elapsed)
+  {
+    const int64_t time = nanoseconds(elapsed);
+
+    Handler& handler = handlers[type];
+
+    handler.count.fetch_add(1, std::memory_order_relaxed);
+    handler.time.fetch_add(time, std::memory_order_relaxed);
+
+    if (time > handler.maxTime.load(std::memory_order_relaxed)) {
+      handler.maxTime.store(time, std::memory_order_relaxed);
+    }
+  }
+
+  uint64_t events_enqueued() const
+  {
+    return enqueues.load(std::memory_order_relaxed);
+  }
+
+  // The (approximate) number of events enqueued per second over the
+  // last window of at least `RATE_WINDOW`. If nothing was enqueued
+  // since the last window closed the rate decays as time passes
+  // rather than being stuck at the rate of that window.
+  double enqueue_rate() const
+  {
+    const int64_t now =
+      nanoseconds(std::chrono::steady_clock::now().time_since_epoch());
+
+    const int64_t elapsed = now - window.load(std::memory_order_relaxed);
+
+    if (elapsed >= RATE_WINDOW) {
+      return (events_enqueued() -
+              windowEnqueues.load(std::memory_order_relaxed)) /
+        Nanoseconds(elapsed).secs();
+    }
+
+    return rate.load(std::memory_order_relaxed);
+  }
+
+  int64_t event_queue_size() const
+  {
+    return size.load(std::memory_order_relaxed);
+  }
+
+  int64_t event_queue_max_size() const
+  {
+    return maxSize.load(std::memory_order_relaxed);
+  }
+
+  // The mean time that the dequeued events waited in the queue.
+  Duration event_queue_mean_time() const
+  {
+    const uint64_t dequeued = dequeues.load(std::memory_order_relaxed);
+
+    return dequeued > 0
+      ? Nanoseconds(queueTime.load(std::memory_order_relaxed) / dequeued)
+      : Duration::zero();
+  }
+
+  Duration event_queue_max_time() const
+  {
+    return Nanoseconds(maxQueueTime.load(std::memory_order_relaxed));
+  }
+
+  uint64_t events_handled(Type type) const
+  {
+    return handlers[type].count.load(std::memory_order_relaxed);
+  }
+
+  Duration handler_time(Type type) const
+  {
+    return Nanoseconds(handlers[type].time.load(std::memory_order_relaxed));
+  }
+
+  Duration handler_max_time(Type type) const
+  {
+    return Nanoseconds(handlers[type].maxTime.load(std::memory_order_relaxed));
+  }
+
+  // Total time spent handling events of all types.
+  Duration handler_time() const
+  {
+    Duration total = Duration::zero();
+    for (int type = 0; type < TYPES; type++) {
+      total += handler_time(static_cast<Type>(type));
+    }
+    return total;
+  }
+
+  operator JSON::Object() const
+  {
+    JSON::Object object;
+
+    object.values["events_enqueued"] = events_enqueued();
+    object.values["enqueue_rate"] = enqueue_rate();
+    object.values["event_queue_size"] = event_queue_size();
+    object.values["event_queue_max_size"] = event_queue_max_size();
+
+    object.values["event_queue_time_mean_ms"] = event_queue_mean_time().ms();
+    object.values["event_queue_time_max_ms"] = event_queue_max_time().ms();
+    object.values["handler_time_ms"] = handler_time().ms();
+
+    JSON::Object handlers;
+    for (int i = 0; i < TYPES; i++) {
+      const Type type = static_cast<Type>(i);
+
+      JSON::Object handler;
+      handler.values["count"] = events_handled(type);
+      handler.values["time_ms"] = handler_time(type).ms();
+      handler.values["time_max_ms"] = handler_max_time(type).ms();
+
+      handlers.values[name(type)] = handler;
+    }
+
+    object.values["handlers"] = handlers;
+
+    return object;
+  }
+
+private:
+  // The enqueue rate is computed over windows of (at least) one
+  // second, in nanoseconds.
+  static constexpr int64_t RATE_WINDOW = 1000000000;
+
+  static int64_t nanoseconds(const std::chrono::steady_clock::duration& d)
+  {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  }
+
+  struct Handler
+  {
+    std::atomic<uint64_t> count = ATOMIC_VAR_INIT(0);
+    std::atomic<int64_t> time = ATOMIC_VAR_INIT(0); // Nanoseconds.
+    std::atomic<int64_t> maxTime = ATOMIC_VAR_INIT(0); // Nanoseconds.
+  };
+
+  std::atomic<uint64_t> enqueues = ATOMIC_VAR_INIT(0);
+
+  // Start of the current window of the enqueue rate (in nanoseconds
+  // of the steady clock), the number of events enqueued before it
+  // and the rate of the previous window.
+  std::atomic<int64_t> window;
+  std::atomic<uint64_t> windowEnqueues = ATOMIC_VAR_INIT(0);
+  std::atomic<double> rate = ATOMIC_VAR_INIT(0.0);
+
+  std::atomic<uint64_t> dequeues = ATOMIC_VAR_INIT(0);
+  std::atomic<int64_t> size = ATOMIC_VAR_INIT(0);
+  std::atomic<int64_t> maxSize = ATOMIC_VAR_INIT(0);
+  std::atomic<int64_t> queueTime = ATOMIC_VAR_INIT(0); // Nanoseconds.
+  std::atomic<int64_t> maxQueueTime = ATOMIC_VAR_INIT(0); // Nanoseconds.
+
+  Handler handlers[TYPES];
+};
+
+} // namespace process {
+
+#endif // __PROCESS_PROCESS_STATISTICS_HPP__
@@ -20,7 +20,12 @@
 //      -DENABLE_LOCK_FREE_RUN_QUEUE (cmake) which enables the
 //      lock-free run queue implementation (see below for more details).
 //
-//  (2) --enable-last-in-first-out-fixed-size-semaphore (autotools) or
+//  (2) --enable-work-stealing-run-queue (autotools) or
+//      -DENABLE_WORK_STEALING_RUN_QUEUE (cmake) which enables a run
+//      queue per worker thread with work stealing (see below for more
+//      details). This can not be combined with (1).
+//
+//  (3) --enable-last-in-first-out-fixed-size-semaphore (autotools) or
 //      -DENABLE_LAST_IN_FIRST_OUT_FIXED_SIZE_SEMAPHORE (cmake) which
 //      enables an optimized semaphore implementation (see semaphore.hpp
 //      for more details).
@@ -31,13 +36,27 @@
 // We choose to make these _compile-time_ decisions rather than
 // _runtime_ decisions because we wanted the run queue implementation
 // to be compile-time optimized (e.g., inlined, etc).
+//
+// All of the run queues respect the scheduling priority of processes
+// (see `ProcessBase::prioritize`): a process of a higher priority is
+// dequeued before a process of a lower priority, except that a lower
+// priority process that has been passed over `STARVATION_LIMIT` times
+// is dequeued next, so that it never starves.
+
+#if defined(LOCK_FREE_RUN_QUEUE) && defined(WORK_STEALING_RUN_QUEUE)
+#error "The lock-free and work stealing run queues are mutually exclusive"
+#endif
 
 #ifdef LOCK_FREE_RUN_QUEUE
 #include <concurrentqueue.h>
 #endif // LOCK_FREE_RUN_QUEUE
 
 #include <algorithm>
-#include <list>
+#include <deque>
+#include <memory>
+#include <vector>
+
+#include <glog/logging.h>
 
 #include <process/process.hpp>
 
@@ -47,20 +66,99 @@
 
 namespace process {
 
-#ifndef LOCK_FREE_RUN_QUEUE
-class RunQueue
+// Number of processes of higher priorities that may be dequeued ahead
+// of a process of a lower priority before that process gets dequeued.
+constexpr size_t STARVATION_LIMIT = 8;
+
+
+// Decides which priority to dequeue a process of next. Keeps track of
+// how many times each priority was passed over while it had processes
+// waiting. NOTE: not thread-safe.
+class PriorityPolicy
 {
 public:
+  static constexpr size_t PRIORITIES = 3;
+
+  static size_t index(ProcessBase::Priority priority)
+  {
+    return static_cast<size_t>(priority);
+  }
+
+  // Returns the priority (index) to dequeue from next given which
+  // priorities have processes waiting, or -1 if none do.
+  int next(const bool (&waiting)[PRIORITIES]) const
+  {
+    // A starved lower priority goes first (the lowest one first).
+    for (size_t i = 0; i < PRIORITIES; i++) {
+      if (waiting[i] && passed[i] >= STARVATION_LIMIT) {
+        return static_cast<int>(i);
+      }
+    }
+
+    for (size_t i = PRIORITIES; i > 0; i--) {
+      if (waiting[i - 1]) {
+        return static_cast<int>(i - 1);
+      }
+    }
+
+    return -1;
+  }
+
+  // Records that a process of the priority 'dequeued' was dequeued.
+  void dequeued(size_t dequeued, const bool (&waiting)[PRIORITIES])
+  {
+    passed[dequeued] = 0;
+
+    for (size_t i = 0; i < dequeued; i++) {
+      if (waiting[i]) {
+        passed[i]++;
+      }
+    }
+  }
+
+private:
+  size_t passed[PRIORITIES] = {};
+};
+
+
+// A FIFO queue of processes for each priority. NOTE: not thread-safe.
+class PriorityQueue
+{
+public:
+  void push(ProcessBase* process)
+  {
+    queues[PriorityPolicy::index(
+        process->priority.load(std::memory_order_relaxed))]
+      .push_back(process);
+  }
+
+  // Returns `nullptr` if the queue is empty.
+  ProcessBase* pop()
+  {
+    bool waiting[PriorityPolicy::PRIORITIES];
+    for (size_t i = 0; i < PriorityPolicy::PRIORITIES; i++) {
+      waiting[i] = !queues[i].empty();
+    }
+
+    const int next = policy.next(waiting);
+    if (next < 0) {
+      return nullptr;
+    }
+
+    ProcessBase* process = queues[next].front();
+    queues[next].pop_front();
+    policy.dequeued(next, waiting);
+    return process;
+  }
+
   bool extract(ProcessBase* process)
   {
-    synchronized (mutex) {
-      std::list<ProcessBase*>::iterator it = std::find(
-          processes.begin(),
-          processes.end(),
-          process);
+    for (std::deque<ProcessBase*>& queue : queues) {
+      std::deque<ProcessBase*>::iterator it =
+        std::find(queue.begin(), queue.end(), process);
 
-      if (it != processes.end()) {
-        processes.erase(it);
+      if (it != queue.end()) {
+        queue.erase(it);
         return true;
       }
     }
@@ -68,6 +166,34 @@ public:
     return false;
   }
 
+  bool empty() const
+  {
+    for (const std::deque<ProcessBase*>& queue : queues) {
+      if (!queue.empty()) {
+        return false;
+      }
+    }
+
+    return true;
+  }
+
+private:
+  std::deque<ProcessBase*> queues[PriorityPolicy::PRIORITIES];
+  PriorityPolicy policy;
+};
+
+
+#if !defined(LOCK_FREE_RUN_QUEUE) && !defined(WORK_STEALING_RUN_QUEUE)
+class RunQueue
+{
+public:
+  bool extract(ProcessBase* process)
+  {
+    synchronized (mutex) {
+      return processes.extract(process);
+    }
+  }
+
   void wait()
   {
     semaphore.wait();
@@ -76,7 +202,7 @@ public:
   void enqueue(ProcessBase* process)
   {
     synchronized (mutex) {
-      processes.push_back(process);
+      processes.push(process);
     }
     epoch.fetch_add(1);
     semaphore.signal();
@@ -86,14 +212,8 @@ public:
   ProcessBase* dequeue()
   {
     synchronized (mutex) {
-      if (!processes.empty()) {
-        ProcessBase* process = processes.front();
-        processes.pop_front();
-        return process;
-      }
+      return processes.pop();
     }
-
-    return nullptr;
   }
 
   // NOTE: this function can't be const because `synchronized (mutex)`
@@ -119,7 +239,7 @@ public:
   std::atomic_long epoch = ATOMIC_VAR_INIT(0L);
 
 private:
-  std::list<ProcessBase*> processes;
+  PriorityQueue processes;
   std::mutex mutex;
 
   // Semaphore used for threads to wait.
@@ -130,7 +250,7 @@ private:
 #endif // LAST_IN_FIRST_OUT_FIXED_SIZE_SEMAPHORE
 };
 
-#else // LOCK_FREE_RUN_QUEUE
+#elif defined(LOCK_FREE_RUN_QUEUE)
 
 class RunQueue
 {
@@ -149,7 +269,9 @@ public:
 
   void enqueue(ProcessBase* process)
   {
-    queue.enqueue(process);
+    queues[PriorityPolicy::index(
+        process->priority.load(std::memory_order_relaxed))]
+      .enqueue(process);
     epoch.fetch_add(1);
     semaphore.signal();
   }
@@ -162,18 +284,200 @@ public:
     // must be called first so we know that there is something to be
     // dequeued or the run queue has been decommissioned and we should
     // just return `nullptr`.
+    //
+    // NOTE: the sizes of the queues are only approximate and the
+    // policy is updated under a spin lock that we don't hold while
+    // dequeueing, so priorities are respected on a best effort basis.
     ProcessBase* process = nullptr;
-    while (!queue.try_dequeue(process)) {
-      if (semaphore.decomissioned()) {
-        break;
+    do {
+      bool waiting[PriorityPolicy::PRIORITIES];
+      for (size_t i = 0; i < PriorityPolicy::PRIORITIES; i++) {
+        waiting[i] = queues[i].size_approx() > 0;
+      }
+
+      int next = -1;
+      synchronized (lock) {
+        next = policy.next(waiting);
+      }
+
+      // Fall back to trying all of the queues, from the highest
+      // priority, if the approximate sizes were off.
+      for (size_t i = 0; i <= PriorityPolicy::PRIORITIES; i++) {
+        const size_t index = i == 0
+          ? (next < 0 ? PriorityPolicy::PRIORITIES - 1 : next)
+          : PriorityPolicy::PRIORITIES - i;
+
+        if (queues[index].try_dequeue(process)) {
+          synchronized (lock) {
+            policy.dequeued(index, waiting);
+          }
+          return process;
+        }
+      }
+    } while (!semaphore.decomissioned());
+
+    return nullptr;
+  }
+
+  bool empty() const
+  {
+    for (size_t i = 0; i < PriorityPolicy::PRIORITIES; i++) {
+      if (queues[i].size_approx() > 0) {
+        return false;
       }
     }
-    return process;
+
+    return true;
+  }
+
+  void decomission()
+  {
+    semaphore.decomission();
+  }
+
+  size_t capacity() const
+  {
+    return semaphore.capacity();
+  }
+
+  // Epoch used to capture changes to the run queue when settling.
+  std::atomic_long epoch = ATOMIC_VAR_INIT(0L);
+
+private:
+  moodycamel::ConcurrentQueue<ProcessBase*> queues[PriorityPolicy::PRIORITIES];
+
+  PriorityPolicy policy;
+  std::atomic_flag lock = ATOMIC_FLAG_INIT;
+
+#ifndef LAST_IN_FIRST_OUT_FIXED_SIZE_SEMAPHORE
+  DecomissionableKernelSemaphore semaphore;
+#else
+  DecomissionableLastInFirstOutFixedSizeSemaphore semaphore;
+#endif // LAST_IN_FIRST_OUT_FIXED_SIZE_SEMAPHORE
+};
+
+#else // WORK_STEALING_RUN_QUEUE
+
+// A run queue that keeps a separate queue of processes for each
+// worker thread. A worker first dequeues from its own queue and only
+// if that is empty does it try and "steal" a process from the queues
+// of the other workers (starting with its neighbor so that not every
+// thief contends on the same queue).
+//
+// A process that gets enqueued by a worker (e.g., because the worker
+// dispatched to it) is put on that worker's queue, which keeps the
+// process (and the events it was just sent) on a warm cache. If
+// `affinity` is enabled we instead prefer the worker that the
+// process was _last_ run on. Either way this is only a preference,
+// an idle worker will still steal the process. Processes enqueued by
+// threads that are not workers (e.g., the event loop) are spread
+// across the workers round-robin.
+//
+// We still use a single semaphore for all of the workers so that a
+// worker only goes to sleep when there is nothing to run, or steal,
+// from any of the queues.
+class RunQueue
+{
+public:
+  // Must be called before any worker calls `wait`.
+  void initialize(size_t workers, bool affinity)
+  {
+    CHECK_GT(workers, 0u);
+    CHECK(queues.empty()) << "Run queue already initialized";
+
+    queues.reserve(workers);
+    for (size_t i = 0; i < workers; i++) {
+      queues.emplace_back(new Queue());
+    }
+
+    this->affinity = affinity;
+  }
+
+  bool extract(ProcessBase* process)
+  {
+    for (const std::unique_ptr<Queue>& queue : queues) {
+      synchronized (queue->mutex) {
+        if (queue->processes.extract(process)) {
+          size.fetch_sub(1);
+          return true;
+        }
+      }
+    }
+
+    return false;
+  }
+
+  void wait()
+  {
+    // NOTE: only worker threads call `wait` so this is where we
+    // lazily assign each worker its own queue.
+    if (worker() < 0) {
+      worker() = workers.fetch_add(1);
+      CHECK_LT((size_t) worker(), queues.size());
+    }
+
+    semaphore.wait();
+  }
+
+  void enqueue(ProcessBase* process)
+  {
+    long index = -1;
+
+    if (affinity) {
+      index = process->worker.load(std::memory_order_relaxed);
+    }
+
+    if (index < 0) {
+      index = worker();
+    }
+
+    if (index < 0 || (size_t) index >= queues.size()) {
+      index = next.fetch_add(1, std::memory_order_relaxed) % queues.size();
+    }
+
+    Queue* queue = queues[index].get();
+
+    synchronized (queue->mutex) {
+      queue->processes.push(process);
+      size.fetch_add(1);
+    }
+    epoch.fetch_add(1);
+    semaphore.signal();
+  }
+
+  // Precondition: `wait` must get called before `dequeue`!
+  ProcessBase* dequeue()
+  {
+    const size_t self = worker();
+
+    // NOTE: a single pass over the queues might miss a process that
+    // gets enqueued on a queue we've already looked at while another
+    // worker takes the process we would have found. Since we've been
+    // signaled for a process that is somewhere in the queues we keep
+    // looking for as long as there are any. The only way there won't
+    // be is if the process we were signaled for has been extracted
+    // (see `extract`) or the run queue was decommissioned.
+    do {
+      for (size_t i = 0; i < queues.size(); i++) {
+        Queue* queue = queues[(self + i) % queues.size()].get();
+
+        synchronized (queue->mutex) {
+          ProcessBase* process = queue->processes.pop();
+          if (process != nullptr) {
+            size.fetch_sub(1);
+            process->worker.store(self, std::memory_order_relaxed);
+            return process;
+          }
+        }
+      }
+    } while (size.load() > 0 && !semaphore.decomissioned());
+
+    return nullptr;
   }
 
   bool empty() const
   {
-    return queue.size_approx() == 0;
+    return size.load() == 0;
   }
 
   void decomission()
@@ -190,7 +494,38 @@ public:
   std::atomic_long epoch = ATOMIC_VAR_INIT(0L);
 
 private:
-  moodycamel::ConcurrentQueue<ProcessBase*> queue;
+  // NOTE: priorities are only respected within a queue, a worker
+  // runs the processes on its own queue before stealing any.
+  struct Queue
+  {
+    PriorityQueue processes;
+    std::mutex mutex;
+  };
+
+  // Index of the queue owned by the calling thread, or -1 if the
+  // calling thread is not a worker.
+  //
+  // NOTE: worker threads are never shared between instances of the
+  // run queue (they get joined when the `ProcessManager` is
+  // destroyed) so it's safe for this to be a thread local.
+  static long& worker()
+  {
+    static thread_local long index = -1;
+    return index;
+  }
+
+  std::vector<std::unique_ptr<Queue>> queues;
+
+  // Total number of processes across all of the queues.
+  std::atomic<size_t> size = ATOMIC_VAR_INIT(0);
+
+  // Number of workers that have been assigned a queue.
+  std::atomic<long> workers = ATOMIC_VAR_INIT(0L);
+
+  // Used to pick a queue when a non-worker enqueues a process.
+  std::atomic<size_t> next = ATOMIC_VAR_INIT(0);
+
+  bool affinity = false;
 
 #ifndef LAST_IN_FIRST_OUT_FIXED_SIZE_SEMAPHORE
   DecomissionableKernelSemaphore semaphore;
@@ -199,7 +534,7 @@ private:
 #endif // LAST_IN_FIRST_OUT_FIXED_SIZE_SEMAPHORE
 };
 
-#endif // LOCK_FREE_RUN_QUEUE
+#endif // WORK_STEALING_RUN_QUEUE
 
 } // namespace process {
 
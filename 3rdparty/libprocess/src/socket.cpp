@@ -12,6 +12,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <boost/shared_array.hpp>
 
@@ -27,9 +29,15 @@
 #ifdef USE_SSL_SOCKET
 #include "libevent_ssl_socket.hpp"
 #endif
+#ifdef USE_IO_URING
+#include "io_uring.hpp"
+#include "io_uring_socket.hpp"
+#endif
 #include "poll_socket.hpp"
 
+using std::pair;
 using std::string;
+using std::vector;
 
 namespace process {
 namespace network {
@@ -39,6 +47,11 @@ Try<std::shared_ptr<SocketImpl>> SocketImpl::create(int_fd s, Kind kind)
 {
   switch (kind) {
     case Kind::POLL:
+#ifdef USE_IO_URING
+      if (io_uring::enabled()) {
+        return IoUringSocketImpl::create(s);
+      }
+#endif
       return PollSocketImpl::create(s);
 #ifdef USE_SSL_SOCKET
     case Kind::SSL:
@@ -241,6 +254,14 @@ Future<Nothing> SocketImpl::send(const string& _data)
     .then(lambda::bind(&_send, shared_from_this(), data, 0, lambda::_1));
 }
 
+
+Future<size_t> SocketImpl::send(const vector<pair<const char*, size_t>>& buffers)
+{
+  CHECK(!buffers.empty());
+
+  return send(buffers.front().first, buffers.front().second);
+}
+
 } // namespace internal {
 } // namespace network {
 } // namespace process {
@@ -18,39 +18,72 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
+#include <atomic>
 #include <deque>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
+#include <tuple>
 #include <vector>
 
+#include <process/clock.hpp>
 #include <process/collect.hpp>
 #include <process/count_down_latch.hpp>
 #include <process/future.hpp>
 #include <process/gmock.hpp>
 #include <process/gtest.hpp>
+#include <process/http.hpp>
 #include <process/owned.hpp>
 #include <process/process.hpp>
 #include <process/protobuf.hpp>
+#include <process/timer.hpp>
+
+#include <process/metrics/counter.hpp>
+#include <process/metrics/sharded_counter.hpp>
+#include <process/metrics/sharded_timer.hpp>
+#include <process/metrics/timer.hpp>
 
 #include <stout/duration.hpp>
+#include <stout/flags.hpp>
 #include <stout/gtest.hpp>
 #include <stout/hashset.hpp>
+#include <stout/ip.hpp>
+#include <stout/json.hpp>
+#include <stout/os.hpp>
 #include <stout/stopwatch.hpp>
+#include <stout/strings.hpp>
 
 #include "benchmarks.pb.h"
 
 namespace http = process::http;
 
+namespace process {
+
+// We need to reinitialize libprocess in order to benchmark different
+// configurations, such as the number of event loops.
+void reinitialize(
+    const Option<std::string>& delegate,
+    const Option<std::string>& readonlyAuthenticationRealm,
+    const Option<std::string>& readwriteAuthenticationRealm);
+
+} // namespace process {
+
+using process::Clock;
 using process::CountDownLatch;
 using process::Future;
 using process::MessageEvent;
 using process::Owned;
+using process::PID;
 using process::Process;
 using process::ProcessBase;
 using process::Promise;
+using process::Time;
+using process::Timer;
 using process::UPID;
 
+using std::cerr;
 using std::cout;
 using std::endl;
 using std::list;
@@ -58,17 +91,188 @@ using std::ostringstream;
 using std::string;
 using std::vector;
 
+// The benchmarks are regular gtest tests (named `*_BENCHMARK_*`), so
+// the usual gtest flags select which benchmarks run
+// (`--gtest_filter`) and how often (`--gtest_repeat`). Sweeps over a
+// parameter are value-parameterized tests.
+class Flags : public virtual flags::FlagsBase
+{
+public:
+  Flags()
+  {
+    add(&Flags::output,
+        "output",
+        "If set, the measurements of the benchmarks are written to this\n"
+        "file as JSON, with one entry per benchmark, parameter and\n"
+        "repetition (see `--gtest_repeat`). This can also be set with\n"
+        "the LIBPROCESS_BENCHMARK_OUTPUT environment variable.");
+  }
+
+  Option<string> output;
+};
+
+
+// Collects the measurements that the benchmarks make (see `record`)
+// and writes them to `--output` once all benchmarks have run:
+//
+//   {
+//     "context": {
+//       "date": "...",
+//       "hostname": "...",
+//       "cpus": 8,
+//       "workers": 8,
+//       "environment": { "LIBPROCESS_NUM_EVENT_LOOPS": "4", ... }
+//     },
+//     "benchmarks": [
+//       {
+//         "name": "EventLoops/EventLoops_BENCHMARK_Test.SocketThroughput/2",
+//         "parameter": "4",
+//         "repetition": 0,
+//         "passed": true,
+//         "elapsed_ms": 1234.5,
+//         "metrics": { "messages_per_second": 12345.6 }
+//       },
+//       ...
+//     ]
+//   }
+class Results : public ::testing::EmptyTestEventListener
+{
+public:
+  static Results* instance()
+  {
+    static Results* results = new Results();
+    return results;
+  }
+
+  void record(const string& metric, double value)
+  {
+    CHECK_SOME(metrics) << "Recorded '" << metric << "' outside of a benchmark";
+
+    metrics->values[metric] = value;
+  }
+
+  Option<string> output;
+
+  virtual void OnTestProgramStart(const ::testing::UnitTest&)
+  {
+    context.values["date"] = stringify(Clock::now());
+
+    Try<string> hostname = net::hostname();
+    if (hostname.isSome()) {
+      context.values["hostname"] = hostname.get();
+    }
+
+    Try<long> cpus = os::cpus();
+    if (cpus.isSome()) {
+      context.values["cpus"] = cpus.get();
+    }
+
+    // The libprocess configuration, e.g., the number of event loops.
+    JSON::Object environment;
+    foreachpair (const string& key, const string& value, os::environment()) {
+      if (strings::startsWith(key, "LIBPROCESS_")) {
+        environment.values[key] = value;
+      }
+    }
+
+    context.values["environment"] = environment;
+  }
+
+  virtual void OnTestIterationStart(const ::testing::UnitTest&, int iteration)
+  {
+    repetition = iteration;
+  }
+
+  virtual void OnTestStart(const ::testing::TestInfo&)
+  {
+    metrics = JSON::Object();
+    watch.start();
+  }
+
+  virtual void OnTestEnd(const ::testing::TestInfo& test)
+  {
+    JSON::Object benchmark;
+    benchmark.values["name"] =
+      string(test.test_case_name()) + "." + test.name();
+
+    if (test.value_param() != nullptr) {
+      benchmark.values["parameter"] = test.value_param();
+    }
+
+    benchmark.values["repetition"] = repetition;
+    benchmark.values["passed"] = test.result()->Passed();
+    benchmark.values["elapsed_ms"] = watch.elapsed().ms();
+    benchmark.values["metrics"] = metrics.get();
+
+    benchmarks.values.push_back(benchmark);
+
+    metrics = None();
+  }
+
+  virtual void OnTestProgramEnd(const ::testing::UnitTest&)
+  {
+    if (output.isNone()) {
+      return;
+    }
+
+    context.values["workers"] = process::workers();
+
+    JSON::Object results;
+    results.values["context"] = context;
+    results.values["benchmarks"] = benchmarks;
+
+    Try<Nothing> write = os::write(output.get(), stringify(results));
+    if (write.isError()) {
+      cerr << "Failed to write the results to '" << output.get() << "': "
+           << write.error() << endl;
+    } else {
+      cout << "Wrote the results to '" << output.get() << "'" << endl;
+    }
+  }
+
+private:
+  JSON::Object context;
+  JSON::Array benchmarks;
+
+  int repetition = 0;
+  Stopwatch watch;
+
+  // The measurements of the benchmark that is running, if any.
+  Option<JSON::Object> metrics;
+};
+
+
+// Records a measurement of the running benchmark, e.g., the number
+// of messages per second. Measurements should be named after what
+// they measure and their unit, e.g., `round_trip_us`.
+static void record(const string& metric, double value)
+{
+  Results::instance()->record(metric, value);
+}
+
+
 int main(int argc, char** argv)
 {
   // Initialize Google Mock/Test.
   testing::InitGoogleMock(&argc, argv);
 
+  // Load our own flags from whatever gtest left behind.
+  Flags flags;
+  Try<flags::Warnings> load = flags.load("LIBPROCESS_BENCHMARK_", argc, argv);
+  if (load.isError()) {
+    cerr << flags.usage(load.error()) << endl;
+    return EXIT_FAILURE;
+  }
+
+  Results::instance()->output = flags.output;
+
   // Add the libprocess test event listeners.
   ::testing::TestEventListeners& listeners =
     ::testing::UnitTest::GetInstance()->listeners();
 
   listeners.Append(process::ClockTestEventListener::instance());
   listeners.Append(process::FilterTestEventListener::instance());
+  listeners.Append(Results::instance());
 
   int result = RUN_ALL_TESTS();
 
@@ -288,6 +492,8 @@ TEST(ProcessTest, Process_BENCHMARK_ClientServer)
   double throughput = (numRequests * numClients) / elapsed.secs();
   cout << "Estimated Total: " << throughput << " rpcs / sec" << endl;
 
+  record("rpcs_per_second", throughput);
+
   foreach (const Owned<ClientProcess>& client, clients) {
     terminate(*client);
     wait(*client);
@@ -371,7 +577,11 @@ TEST(ProcessTest, Process_BENCHMARK_LargeNumberOfLinks)
     delete process;
   }
 
-  cout << "Elapsed: " << watch.elapsed() << endl;
+  Duration elapsed = watch.elapsed();
+
+  cout << "Elapsed: " << elapsed << endl;
+
+  record("exits_per_second", iterations / elapsed.secs());
 
   foreach (ProcessBase* process, processes) {
     terminate(process);
@@ -482,6 +692,8 @@ TEST(ProcessTest, Process_BENCHMARK_ThroughputPerformance)
 
   cout << "Estimated Total: " << std::fixed << throughput << endl;
 
+  record("messages_per_second", throughput);
+
   foreach (const Owned<Client>& client, clients) {
     terminate(client->self());
     wait(client->self());
@@ -494,6 +706,482 @@ TEST(ProcessTest, Process_BENCHMARK_ThroughputPerformance)
 }
 
 
+// A client which is like `Client` above except that it sends its
+// messages to a `ServerProcess` over sockets. Libprocess delivers
+// messages between local processes without using a socket, so the
+// client addresses both the destination and itself using an
+// alternate loopback IP. Since libprocess listens on all interfaces
+// by default (i.e., when `LIBPROCESS_IP` is not set) these messages
+// (and the replies to them) are still received by this instance of
+// libprocess, but only after going through a socket.
+class SocketClient : public Process<SocketClient>
+{
+public:
+  SocketClient(
+      const UPID& _destination,
+      const net::IP& ip,
+      CountDownLatch* _latch,
+      long _repeat,
+      long _concurrency,
+      const string& _body = "")
+    : destination(_destination.id, ip, _destination.address.port),
+      latch(_latch),
+      repeat(_repeat),
+      concurrency(_concurrency),
+      body(_body)
+  {
+    from = UPID(self().id, ip, self().address.port);
+  }
+
+protected:
+  virtual void initialize()
+  {
+    // Link so that we use a persistent socket rather than a
+    // temporary socket which gets closed whenever there is nothing
+    // more to send.
+    link(destination);
+  }
+
+  virtual void visit(const MessageEvent& event)
+  {
+    if (event.message.name == "pong") {
+      received += 1;
+      if (sent < repeat) {
+        post(from, destination, "ping", body.data(), body.size());
+        sent += 1;
+      } else if (received >= repeat) {
+        latch->decrement();
+      }
+    } else if (event.message.name == "run") {
+      for (long l = 0; l < std::min(concurrency, repeat); l++) {
+        post(from, destination, "ping", body.data(), body.size());
+        sent += 1;
+      }
+    }
+  }
+
+private:
+  UPID from;
+  UPID destination;
+  CountDownLatch* latch;
+  long repeat;
+  long concurrency;
+  const string body;
+  long sent = 0L;
+  long received = 0L;
+};
+
+
+// Parameterized by the number of event loops that libprocess shards
+// its sockets across (i.e., `LIBPROCESS_NUM_EVENT_LOOPS`).
+class EventLoops_BENCHMARK_Test : public ::testing::TestWithParam<size_t>
+{
+protected:
+  virtual void SetUp()
+  {
+    os::setenv("LIBPROCESS_NUM_EVENT_LOOPS", stringify(GetParam()));
+    process::reinitialize(None(), None(), None());
+  }
+
+public:
+  static void TearDownTestCase()
+  {
+    os::unsetenv("LIBPROCESS_NUM_EVENT_LOOPS");
+    process::reinitialize(None(), None(), None());
+  }
+};
+
+
+INSTANTIATE_TEST_CASE_P(
+    EventLoops,
+    EventLoops_BENCHMARK_Test,
+    ::testing::Values(1U, 2U, 4U, 8U));
+
+
+// Measures the message throughput of many client/server pairs that
+// communicate over sockets (one pair of sockets per client) as
+// the number of event loops increases.
+TEST_P(EventLoops_BENCHMARK_Test, SocketThroughput)
+{
+  const long numberOfClients = 32;
+  const long repeatPerClient = 2000;
+  const long concurrency = 100;
+
+  // Each client uses a distinct loopback IP so that it gets its own
+  // sockets (libprocess creates one outbound socket per address). We
+  // must skip the IP that libprocess itself uses, otherwise messages
+  // would get delivered locally.
+  vector<net::IP> ips;
+  for (int i = 2; ips.size() < (size_t) numberOfClients; i++) {
+    Try<net::IP> ip = net::IP::parse("127.0.0." + stringify(i), AF_INET);
+    ASSERT_SOME(ip);
+
+    if (ip.get() != process::address().ip) {
+      ips.push_back(ip.get());
+    }
+  }
+
+  CountDownLatch latch(numberOfClients);
+
+  vector<Owned<ServerProcess>> servers;
+  vector<Owned<SocketClient>> clients;
+
+  for (long i = 0; i < numberOfClients; i++) {
+    Owned<ServerProcess> server(new ServerProcess());
+
+    spawn(*server);
+
+    Owned<SocketClient> client(new SocketClient(
+        server->self(),
+        ips[i],
+        &latch,
+        repeatPerClient,
+        concurrency));
+
+    spawn(*client);
+
+    servers.push_back(server);
+    clients.push_back(client);
+  }
+
+  Stopwatch watch;
+  watch.start();
+
+  foreach (const Owned<SocketClient>& client, clients) {
+    post(client->self(), "run");
+  }
+
+  AWAIT_READY_FOR(latch.triggered(), Minutes(5));
+
+  Duration elapsed = watch.elapsed();
+
+  double throughput = (numberOfClients * repeatPerClient) / elapsed.secs();
+
+  cout << "Event loops: " << GetParam() << ", "
+       << "estimated total: " << std::fixed << throughput
+       << " messages / sec" << endl;
+
+  record("messages_per_second", throughput);
+
+  foreach (const Owned<SocketClient>& client, clients) {
+    terminate(client->self());
+    wait(client->self());
+  }
+
+  foreach (const Owned<ServerProcess>& server, servers) {
+    terminate(server->self());
+    wait(server->self());
+  }
+}
+
+
+// Parameterized by whether links use binary message framing (i.e.,
+// `LIBPROCESS_ENABLE_MESSAGE_FRAMING`) and by the message body size.
+class MessageFraming_BENCHMARK_Test
+  : public ::testing::TestWithParam<std::tuple<bool, size_t>>
+{
+protected:
+  virtual void SetUp()
+  {
+    os::setenv(
+        "LIBPROCESS_ENABLE_MESSAGE_FRAMING",
+        stringify(std::get<0>(GetParam())));
+
+    process::reinitialize(None(), None(), None());
+  }
+
+public:
+  static void TearDownTestCase()
+  {
+    os::unsetenv("LIBPROCESS_ENABLE_MESSAGE_FRAMING");
+    process::reinitialize(None(), None(), None());
+  }
+};
+
+
+INSTANTIATE_TEST_CASE_P(
+    MessageFraming,
+    MessageFraming_BENCHMARK_Test,
+    ::testing::Combine(
+        ::testing::Bool(),
+        ::testing::Values(0U, 1024U, 64U * 1024U)));
+
+
+// Runs `numberOfClients` ping pong games over sockets (see
+// `SocketClient`) with the given number of messages in flight per
+// client, and returns how long it took.
+static Duration runSocketPingPong(
+    long numberOfClients,
+    long repeatPerClient,
+    long concurrency,
+    const string& body)
+{
+  vector<net::IP> ips;
+  for (int i = 2; ips.size() < (size_t) numberOfClients; i++) {
+    Try<net::IP> ip = net::IP::parse("127.0.0." + stringify(i), AF_INET);
+    CHECK_SOME(ip);
+
+    if (ip.get() != process::address().ip) {
+      ips.push_back(ip.get());
+    }
+  }
+
+  CountDownLatch latch(numberOfClients);
+
+  vector<Owned<ServerProcess>> servers;
+  vector<Owned<SocketClient>> clients;
+
+  for (long i = 0; i < numberOfClients; i++) {
+    Owned<ServerProcess> server(new ServerProcess());
+
+    spawn(*server);
+
+    Owned<SocketClient> client(new SocketClient(
+        server->self(),
+        ips[i],
+        &latch,
+        repeatPerClient,
+        concurrency,
+        body));
+
+    spawn(*client);
+
+    servers.push_back(server);
+    clients.push_back(client);
+  }
+
+  Stopwatch watch;
+  watch.start();
+
+  foreach (const Owned<SocketClient>& client, clients) {
+    post(client->self(), "run");
+  }
+
+  CHECK(latch.triggered().await(Minutes(5)));
+
+  Duration elapsed = watch.elapsed();
+
+  foreach (const Owned<SocketClient>& client, clients) {
+    terminate(client->self());
+    wait(client->self());
+  }
+
+  foreach (const Owned<ServerProcess>& server, servers) {
+    terminate(server->self());
+    wait(server->self());
+  }
+
+  return elapsed;
+}
+
+
+// Measures the message throughput of client/server pairs that keep
+// many messages in flight over their links.
+TEST_P(MessageFraming_BENCHMARK_Test, Throughput)
+{
+  const long numberOfClients = 8;
+  const long repeatPerClient = 1000;
+  const long concurrency = 100;
+
+  const string body(std::get<1>(GetParam()), '1');
+
+  Duration elapsed = runSocketPingPong(
+      numberOfClients, repeatPerClient, concurrency, body);
+
+  // Every ping is answered with a pong of the same size.
+  const long messages = 2 * numberOfClients * repeatPerClient;
+
+  cout << "Framing: " << (std::get<0>(GetParam()) ? "binary" : "http") << ", "
+       << "body size: " << Bytes(body.size()) << ", "
+       << "estimated total: " << std::fixed << (messages / elapsed.secs())
+       << " messages / sec" << endl;
+
+  record("messages_per_second", messages / elapsed.secs());
+}
+
+
+// Measures the round trip time of a single ping pong over a link when
+// only one message is in flight at a time.
+TEST_P(MessageFraming_BENCHMARK_Test, Latency)
+{
+  const long repeat = 1000;
+
+  const string body(std::get<1>(GetParam()), '1');
+
+  Duration elapsed = runSocketPingPong(1, repeat, 1, body);
+
+  cout << "Framing: " << (std::get<0>(GetParam()) ? "binary" : "http") << ", "
+       << "body size: " << Bytes(body.size()) << ", "
+       << "average round trip: " << (elapsed / repeat) << endl;
+
+  record("round_trip_us", (elapsed / repeat).us());
+}
+
+
+// A process that responds to every request with a body of the
+// requested size.
+class HttpServerProcess : public Process<HttpServerProcess>
+{
+protected:
+  virtual void initialize()
+  {
+    route("/body", None(), [](const http::Request& request)
+        -> Future<http::Response> {
+      Try<size_t> size =
+        numify<size_t>(request.url.query.get("size").getOrElse("0"));
+      if (size.isError()) {
+        return http::BadRequest("Invalid 'size': " + size.error());
+      }
+
+      return http::OK(string(size.get(), '1'));
+    });
+  }
+};
+
+
+// Parameterized by the size of the response body and the number of
+// requests that are pipelined on the connection.
+class Http_BENCHMARK_Test
+  : public ::testing::TestWithParam<std::tuple<size_t, size_t>> {};
+
+
+INSTANTIATE_TEST_CASE_P(
+    BodySizeAndPipelining,
+    Http_BENCHMARK_Test,
+    ::testing::Combine(
+        ::testing::Values(0U, 1024U, 64U * 1024U),
+        ::testing::Values(1U, 16U)));
+
+
+// Measures HTTP requests and responses over a single persistent
+// connection, i.e., request encoding and decoding, routing to the
+// process and response encoding and decoding.
+TEST_P(Http_BENCHMARK_Test, RequestResponse)
+{
+  const size_t size = std::get<0>(GetParam());
+  const size_t pipelined = std::get<1>(GetParam());
+  const size_t requests = 5000;
+
+  HttpServerProcess server;
+  spawn(server);
+
+  http::URL url(
+      "http",
+      server.self().address.ip,
+      server.self().address.port,
+      server.self().id + "/body",
+      {{"size", stringify(size)}});
+
+  Future<http::Connection> connect = http::connect(url);
+  AWAIT_READY(connect);
+
+  http::Connection connection = connect.get();
+
+  http::Request request;
+  request.method = "GET";
+  request.url = url;
+  request.keepAlive = true;
+
+  Stopwatch watch;
+  watch.start();
+
+  for (size_t sent = 0; sent < requests; sent += pipelined) {
+    list<Future<http::Response>> responses;
+    for (size_t i = 0; i < pipelined; i++) {
+      responses.push_back(connection.send(request));
+    }
+
+    foreach (const Future<http::Response>& response, responses) {
+      AWAIT_READY(response);
+      ASSERT_EQ(http::Status::OK, response->code);
+      ASSERT_EQ(size, response->body.size());
+    }
+  }
+
+  Duration elapsed = watch.elapsed();
+
+  cout << "Body size: " << Bytes(size) << ", "
+       << "pipelined: " << pipelined << ", "
+       << "estimated total: " << std::fixed << (requests / elapsed.secs())
+       << " requests / sec" << endl;
+
+  record("requests_per_second", requests / elapsed.secs());
+
+  AWAIT_READY(connection.disconnect());
+
+  terminate(server);
+  wait(server);
+}
+
+
+// Parameterized by the number of outstanding timers.
+class Timers_BENCHMARK_Test : public ::testing::TestWithParam<size_t> {};
+
+
+INSTANTIATE_TEST_CASE_P(
+    OutstandingTimers,
+    Timers_BENCHMARK_Test,
+    ::testing::Values(10000U, 100000U, 1000000U));
+
+
+// Measures the cost of creating and canceling timers when there are
+// many timers outstanding, similar to a master that has timers for
+// offers, agent pings, filters, status update retries, etc.
+TEST_P(Timers_BENCHMARK_Test, TimerChurn)
+{
+  // Make sure the event loop that fires the timers is running.
+  process::initialize();
+
+  const size_t outstanding = GetParam();
+
+  // Spread the timeouts between 1 second and (roughly) 1 hour.
+  auto duration = [](size_t i) {
+    return Seconds(1) + Milliseconds((i * 7919) % 3600000);
+  };
+
+  vector<Timer> timers;
+  timers.reserve(outstanding);
+
+  Stopwatch watch;
+  watch.start();
+
+  for (size_t i = 0; i < outstanding; i++) {
+    timers.push_back(Clock::timer(duration(i), []() {}));
+  }
+
+  cout << "Created " << outstanding << " timers in "
+       << watch.elapsed() << endl;
+
+  record("create_ms", watch.elapsed().ms());
+
+  // Now replace each timer with a new one, which is what happens
+  // when, e.g., a status update is acknowledged and the retry timer
+  // is canceled before a new one is created.
+  watch.start();
+
+  for (size_t i = 0; i < outstanding; i++) {
+    Clock::cancel(timers[i]);
+    timers[i] = Clock::timer(duration(i + outstanding), []() {});
+  }
+
+  cout << "Replaced " << outstanding << " timers in "
+       << watch.elapsed() << endl;
+
+  record("replace_ms", watch.elapsed().ms());
+
+  watch.start();
+
+  foreach (const Timer& timer, timers) {
+    Clock::cancel(timer);
+  }
+
+  cout << "Canceled " << outstanding << " timers in "
+       << watch.elapsed() << endl;
+
+  record("cancel_ms", watch.elapsed().ms());
+}
+
+
 class DispatchProcess : public Process<DispatchProcess>
 {
 public:
@@ -547,7 +1235,12 @@ public:
 
     AWAIT_READY(promise.future());
 
-    cout << name << " elapsed: " << watch.elapsed() << endl;
+    Duration elapsed = watch.elapsed();
+
+    cout << name << " elapsed: " << elapsed << endl;
+
+    record(strings::lower(name) + "_dispatches_per_second",
+           repeats / elapsed.secs());
 
     terminate(process.get());
     wait(process.get());
@@ -580,6 +1273,258 @@ TEST(ProcessTest, Process_BENCHMARK_DispatchDefer)
 }
 
 
+// Parameterized by the number of continuations chained on a future.
+class FutureChain_BENCHMARK_Test : public ::testing::TestWithParam<size_t> {};
+
+
+INSTANTIATE_TEST_CASE_P(
+    Continuations,
+    FutureChain_BENCHMARK_Test,
+    ::testing::Values(1U, 10U, 100U));
+
+
+// Measures the cost of chaining continuations with `Future::then`
+// on pending futures (construction) and of running them once the
+// futures are completed (satisfaction).
+TEST_P(FutureChain_BENCHMARK_Test, Then)
+{
+  const size_t length = GetParam();
+  const size_t continuations = 1000000;
+
+  // The chains are constructed and satisfied in batches so that we
+  // can time both separately without keeping all of them around.
+  const size_t chains = 10000 / length;
+
+  Duration construction = Duration::zero();
+  Duration satisfaction = Duration::zero();
+
+  for (size_t chained = 0; chained < continuations;
+       chained += chains * length) {
+    vector<Promise<size_t>> promises(chains);
+    vector<Future<size_t>> futures;
+    futures.reserve(chains);
+
+    Stopwatch watch;
+    watch.start();
+
+    foreach (const Promise<size_t>& promise, promises) {
+      Future<size_t> future = promise.future();
+      for (size_t i = 0; i < length; i++) {
+        future = future.then([](size_t value) { return value + 1; });
+      }
+
+      futures.push_back(future);
+    }
+
+    construction += watch.elapsed();
+
+    watch.start();
+
+    foreach (Promise<size_t>& promise, promises) {
+      promise.set(0);
+    }
+
+    satisfaction += watch.elapsed();
+
+    foreach (const Future<size_t>& future, futures) {
+      ASSERT_TRUE(future.isReady());
+      ASSERT_EQ(length, future.get());
+    }
+  }
+
+  cout << "Chain length: " << length << ", "
+       << "average per continuation: "
+       << (construction / continuations) << " to chain, "
+       << (satisfaction / continuations) << " to run" << endl;
+
+  record("construction_ns", (construction / continuations).ns());
+  record("satisfaction_ns", (satisfaction / continuations).ns());
+  record(
+      "continuations_per_second",
+      continuations / (construction + satisfaction).secs());
+}
+
+
+// Measures the cost of chaining continuations with `Future::then` on
+// futures that are already completed, where each continuation runs
+// as soon as it is chained.
+TEST_P(FutureChain_BENCHMARK_Test, Ready)
+{
+  const size_t length = GetParam();
+  const size_t continuations = 1000000;
+
+  Stopwatch watch;
+  watch.start();
+
+  for (size_t chained = 0; chained < continuations; chained += length) {
+    Future<size_t> future = 0;
+    for (size_t i = 0; i < length; i++) {
+      future = future.then([](size_t value) { return value + 1; });
+    }
+
+    ASSERT_TRUE(future.isReady());
+    ASSERT_EQ(length, future.get());
+  }
+
+  Duration elapsed = watch.elapsed();
+
+  cout << "Chain length: " << length << ", "
+       << "average per continuation: " << (elapsed / continuations) << endl;
+
+  record("continuations_per_second", continuations / elapsed.secs());
+}
+
+
+// Parameterized by the number of futures that are collected.
+class Collect_BENCHMARK_Test : public ::testing::TestWithParam<size_t> {};
+
+
+INSTANTIATE_TEST_CASE_P(
+    Futures,
+    Collect_BENCHMARK_Test,
+    ::testing::Values(10U, 1000U, 100000U));
+
+
+// Measures `collect` of futures that are completed after they have
+// been collected, which includes spawning the collecting process.
+TEST_P(Collect_BENCHMARK_Test, Collect)
+{
+  const size_t count = GetParam();
+  const size_t total = 100000;
+
+  Stopwatch watch;
+  watch.start();
+
+  for (size_t collected = 0; collected < total; collected += count) {
+    vector<Promise<size_t>> promises(count);
+
+    list<Future<size_t>> futures;
+    foreach (Promise<size_t>& promise, promises) {
+      futures.push_back(promise.future());
+    }
+
+    Future<list<size_t>> collect = process::collect(futures);
+
+    for (size_t i = 0; i < count; i++) {
+      promises[i].set(i);
+    }
+
+    AWAIT_READY(collect);
+    ASSERT_EQ(count, collect->size());
+  }
+
+  Duration elapsed = watch.elapsed();
+
+  cout << "Futures: " << count << ", "
+       << "average per collect: " << (elapsed / (total / count)) << endl;
+
+  record("futures_per_second", total / elapsed.secs());
+}
+
+
+// Parameterized by the number of threads updating a metric at once.
+class Metrics_BENCHMARK_Test : public ::testing::TestWithParam<size_t> {};
+
+
+INSTANTIATE_TEST_CASE_P(
+    Threads,
+    Metrics_BENCHMARK_Test,
+    ::testing::Values(1U, 4U, 16U));
+
+
+// Runs `f` on the specified number of threads at once and returns
+// the average time per call.
+template <typename F>
+static Duration contend(size_t threads, size_t calls, const F& f)
+{
+  // Have all the threads start at once so they contend the whole time.
+  CountDownLatch ready(threads);
+  std::atomic_bool start(false);
+
+  vector<std::thread> threads_;
+
+  for (size_t i = 0; i < threads; i++) {
+    threads_.emplace_back([&]() {
+      ready.decrement();
+
+      while (!start.load()) {}
+
+      for (size_t j = 0; j < calls; j++) {
+        f();
+      }
+    });
+  }
+
+  ready.triggered().await();
+
+  Stopwatch watch;
+  watch.start();
+  start.store(true);
+
+  foreach (std::thread& thread, threads_) {
+    thread.join();
+  }
+
+  return watch.elapsed() / calls;
+}
+
+
+// Compares incrementing a `Counter` to incrementing a `ShardedCounter`
+// from several threads at once.
+TEST_P(Metrics_BENCHMARK_Test, Counter)
+{
+  const size_t threads = GetParam();
+  const size_t increments = 1000000;
+
+  process::metrics::Counter counter("counter");
+  process::metrics::ShardedCounter sharded("sharded_counter");
+
+  Duration elapsed = contend(threads, increments, [&]() { ++counter; });
+  Duration elapsedSharded =
+    contend(threads, increments, [&]() { ++sharded; });
+
+  EXPECT_EQ(threads * increments, counter.value().get());
+  EXPECT_EQ(threads * increments, sharded.value().get());
+
+  cout << "Threads: " << threads << ", average per increment: "
+       << elapsed << " (Counter), "
+       << elapsedSharded << " (ShardedCounter)" << endl;
+
+  record("counter_ns", elapsed.ns());
+  record("sharded_counter_ns", elapsedSharded.ns());
+}
+
+
+// Compares timing events with a `Timer` to timing them with a
+// `ShardedTimer` from several threads at once, with statistics.
+TEST_P(Metrics_BENCHMARK_Test, Timer)
+{
+  const size_t threads = GetParam();
+  const size_t timings = 10000;
+
+  process::metrics::Timer<Microseconds> timer(
+      "timer", process::TIME_SERIES_WINDOW);
+  process::metrics::ShardedTimer<Microseconds> sharded(
+      "sharded_timer", process::TIME_SERIES_WINDOW);
+
+  Duration elapsed = contend(threads, timings, [&]() {
+    timer.start();
+    timer.stop();
+  });
+
+  Duration elapsedSharded = contend(threads, timings, [&]() {
+    sharded.stop(sharded.start());
+  });
+
+  cout << "Threads: " << threads << ", average per timing: "
+       << elapsed << " (Timer), "
+       << elapsedSharded << " (ShardedTimer)" << endl;
+
+  record("timer_ns", elapsed.ns());
+  record("sharded_timer_ns", elapsedSharded.ns());
+}
+
+
 class ProtobufInstallHandlerBenchmarkProcess
   : public ProtobufProcess<ProtobufInstallHandlerBenchmarkProcess>
 {
@@ -624,6 +1569,10 @@ public:
     cout << "Size: " << std::setw(5) << data.length() << " bytes,"
          << " throughput: " << std::setw(9) << std::setprecision(0)
          << std::fixed << messagesPerSecond << " messages/s" << endl;
+
+    record(
+        "submessages_" + stringify(submessages) + "_messages_per_second",
+        messagesPerSecond);
   }
 
 private:
@@ -681,3 +1630,119 @@ TEST(ProcessTest, Process_BENCHMARK_ProtobufInstallHandler)
     process.run(num_submessages);
   }
 }
+
+
+// A process that keeps the worker threads busy by handing some
+// (spinning) work back and forth with a peer until stopped. NOTE: the
+// work is not dispatched to the process itself since a process keeps
+// its worker thread for as long as it has events queued.
+class BusyProcess : public Process<BusyProcess>
+{
+public:
+  explicit BusyProcess(const std::atomic_bool* _stopped)
+    : stopped(_stopped) {}
+
+  void spin(const PID<BusyProcess>& peer)
+  {
+    Stopwatch watch;
+    watch.start();
+    while (watch.elapsed() < Microseconds(50)) {}
+
+    if (!stopped->load()) {
+      dispatch(peer, &BusyProcess::spin, self());
+    }
+  }
+
+private:
+  const std::atomic_bool* stopped;
+};
+
+
+class LatencyProcess : public Process<LatencyProcess>
+{
+public:
+  explicit LatencyProcess(Priority priority)
+  {
+    prioritize(priority);
+  }
+
+  Duration latency(const Time& sent) { return Clock::now() - sent; }
+};
+
+
+// Parameterized by the scheduling priority of the process whose
+// dispatch latency gets measured.
+class Priority_BENCHMARK_Test
+  : public ::testing::TestWithParam<ProcessBase::Priority> {};
+
+
+INSTANTIATE_TEST_CASE_P(
+    Priority,
+    Priority_BENCHMARK_Test,
+    ::testing::Values(
+        ProcessBase::Priority::NORMAL,
+        ProcessBase::Priority::HIGH));
+
+
+// Measures the latency of dispatches to a process while the worker
+// threads are kept busy by many other processes, i.e., how long a
+// process waits in the run queue depending on its priority.
+TEST_P(Priority_BENCHMARK_Test, DispatchLatency)
+{
+  const ProcessBase::Priority priority = GetParam();
+  const size_t pairs = 64;
+  const size_t dispatches = 1000;
+
+  std::atomic_bool stopped(false);
+
+  vector<Owned<BusyProcess>> processes;
+  for (size_t i = 0; i < pairs; i++) {
+    Owned<BusyProcess> ping(new BusyProcess(&stopped));
+    Owned<BusyProcess> pong(new BusyProcess(&stopped));
+
+    spawn(*ping);
+    spawn(*pong);
+
+    dispatch(*ping, &BusyProcess::spin, pong->self());
+
+    processes.push_back(ping);
+    processes.push_back(pong);
+  }
+
+  LatencyProcess process(priority);
+  spawn(process);
+
+  // NOTE: the latency is measured by the process itself so that it
+  // does not include the time it takes for this thread to get
+  // scheduled again (the worker threads are all busy).
+  list<Future<Duration>> futures;
+  for (size_t i = 0; i < dispatches; i++) {
+    futures.push_back(
+        dispatch(process, &LatencyProcess::latency, Clock::now()));
+
+    os::sleep(Milliseconds(1));
+  }
+
+  Future<list<Duration>> collected = collect(futures);
+  AWAIT_READY_FOR(collected, Minutes(1));
+
+  vector<Duration> latencies(collected->begin(), collected->end());
+
+  stopped.store(true);
+
+  foreach (const Owned<BusyProcess>& process, processes) {
+    terminate(*process);
+    wait(*process);
+  }
+
+  terminate(process);
+  wait(process);
+
+  std::sort(latencies.begin(), latencies.end());
+
+  cout << "Priority "
+       << (priority == ProcessBase::Priority::HIGH ? "HIGH" : "NORMAL")
+       << " dispatch latency: p50 " << latencies[dispatches / 2]
+       << ", p99 " << latencies[dispatches * 99 / 100]
+       << ", max " << latencies.back() << endl;
+}
@@ -26,6 +26,8 @@ namespace http = process::http;
 
 using process::DataDecoder;
 using process::Future;
+using process::Message;
+using process::MessageFrameDecoder;
 using process::Owned;
 using process::ResponseDecoder;
 using process::StreamingRequestDecoder;
@@ -325,3 +327,61 @@ TEST(DecoderTest, StreamingResponseInvalidHeader)
 
   EXPECT_TRUE(decoder.failed());
 }
+
+
+// Messages from libprocess peers are buffered by the decoder rather
+// than streamed through a pipe so their bodies needn't be copied again.
+TEST(DecoderTest, StreamingRequestMessage)
+{
+  StreamingRequestDecoder decoder;
+
+  const string data =
+    "POST /receiver/ping HTTP/1.1\r\n"
+    "User-Agent: libprocess/sender@10.0.0.2:5050\r\n"
+    "Libprocess-From: sender@10.0.0.2:5050\r\n"
+    "Connection: Keep-Alive\r\n"
+    "Host: \r\n"
+    "Transfer-Encoding: chunked\r\n"
+    "\r\n"
+    "5\r\n"
+    "hello\r\n"
+    "6\r\n"
+    " world\r\n"
+    "0\r\n"
+    "\r\n";
+
+  // The request isn't returned until its whole body has arrived.
+  deque<http::Request*> requests = decoder.decode(data.data(), 180);
+  ASSERT_FALSE(decoder.failed());
+  EXPECT_TRUE(requests.empty());
+
+  requests = decoder.decode(data.data() + 180, data.length() - 180);
+  ASSERT_FALSE(decoder.failed());
+  ASSERT_EQ(1u, requests.size());
+
+  Owned<http::Request> request(requests[0]);
+  EXPECT_EQ("POST", request->method);
+  EXPECT_EQ("/receiver/ping", request->url.path);
+  ASSERT_EQ(http::Request::BODY, request->type);
+  EXPECT_EQ("hello world", request->body);
+}
+
+
+TEST(DecoderTest, MessageFrameMalformed)
+{
+  // A frame of 10 bytes whose 'from' claims to be 16 bytes long.
+  const string frame("\x00\x00\x00\x0a\x00\x00\x00\x10sender", 14);
+
+  MessageFrameDecoder decoder(process::network::inet4::Address::LOOPBACK_ANY());
+
+  // The decoder can't tell that the frame is malformed until it has
+  // the length of 'from', but then fails without waiting for the rest
+  // of the frame.
+  deque<Message*> messages = decoder.decode(frame.data(), 6);
+  EXPECT_TRUE(messages.empty());
+  EXPECT_FALSE(decoder.failed());
+
+  messages = decoder.decode(frame.data() + 6, 2);
+  EXPECT_TRUE(messages.empty());
+  EXPECT_TRUE(decoder.failed());
+}
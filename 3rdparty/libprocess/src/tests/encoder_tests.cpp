@@ -12,12 +12,15 @@
 
 #include <gmock/gmock.h>
 
+#include <algorithm>
 #include <deque>
 #include <string>
 #include <vector>
 
 #include <process/http.hpp>
+#include <process/message.hpp>
 #include <process/owned.hpp>
+#include <process/pid.hpp>
 #include <process/socket.hpp>
 
 #include <stout/gtest.hpp>
@@ -28,8 +31,12 @@
 namespace http = process::http;
 
 using process::HttpResponseEncoder;
+using process::Message;
+using process::MessageFrameDecoder;
+using process::MessageFrameEncoder;
 using process::Owned;
 using process::ResponseDecoder;
+using process::UPID;
 
 using std::deque;
 using std::string;
@@ -69,6 +76,53 @@ TEST(EncoderTest, Response)
 }
 
 
+TEST(EncoderTest, CompressedResponse)
+{
+  const http::OK response(string(2 * process::GZIP_MINIMUM_BODY_LENGTH, 'a'));
+
+  // Clients accepting both "gzip" and "deflate" get "gzip".
+  http::Request request;
+  request.headers["Accept-Encoding"] = "deflate, gzip";
+
+  string encoded = HttpResponseEncoder::encode(response, request);
+
+  ResponseDecoder decoder;
+  deque<http::Response*> responses =
+    decoder.decode(encoded.data(), encoded.length());
+
+  ASSERT_FALSE(decoder.failed());
+  ASSERT_EQ(1u, responses.size());
+
+  Owned<http::Response> decoded(responses[0]);
+  EXPECT_SOME_EQ("gzip", decoded->headers.get("Content-Encoding"));
+  EXPECT_EQ(response.body, decoded->body);
+
+  // The decoder also decompresses "deflate" bodies.
+  request.headers["Accept-Encoding"] = "deflate";
+
+  encoded = HttpResponseEncoder::encode(response, request);
+  responses = decoder.decode(encoded.data(), encoded.length());
+
+  ASSERT_FALSE(decoder.failed());
+  ASSERT_EQ(1u, responses.size());
+
+  decoded.reset(responses[0]);
+  EXPECT_SOME_EQ("deflate", decoded->headers.get("Content-Encoding"));
+  EXPECT_EQ(response.body, decoded->body);
+
+  // Small bodies are not compressed.
+  encoded = HttpResponseEncoder::encode(http::OK("body"), request);
+  responses = decoder.decode(encoded.data(), encoded.length());
+
+  ASSERT_FALSE(decoder.failed());
+  ASSERT_EQ(1u, responses.size());
+
+  decoded.reset(responses[0]);
+  EXPECT_NONE(decoded->headers.get("Content-Encoding"));
+  EXPECT_EQ("body", decoded->body);
+}
+
+
 TEST(EncoderTest, AcceptableEncodings)
 {
   // Create requests that do not accept gzip encoding.
@@ -115,3 +169,52 @@ TEST(EncoderTest, AcceptableEncodings)
       << gzipRequest.headers.get("Accept-Encoding").get() << "'";
   }
 }
+
+
+TEST(EncoderTest, MessageFrame)
+{
+  const UPID to("receiver@10.0.0.1:5051");
+
+  Message message1;
+  message1.name = "ping";
+  message1.from = UPID("sender@10.0.0.2:5050");
+  message1.to = to;
+  message1.body = string(100000, 'x');
+
+  // The second message has neither a body nor a receiver ID.
+  Message message2;
+  message2.name = "pong";
+  message2.from = message1.from;
+  message2.to = UPID("", to.address);
+
+  const string encoded =
+    MessageFrameEncoder::encode(message1) +
+    MessageFrameEncoder::encode(message2);
+
+  // Feed the frames to the decoder in odd sized pieces to make sure
+  // it copes with frames (and their headers) being split.
+  MessageFrameDecoder decoder(to.address);
+  deque<Message*> messages;
+
+  for (size_t i = 0; i < encoded.size(); i += 7) {
+    const size_t length = std::min<size_t>(7, encoded.size() - i);
+    foreach (Message* message, decoder.decode(encoded.data() + i, length)) {
+      messages.push_back(message);
+    }
+  }
+
+  ASSERT_FALSE(decoder.failed());
+  ASSERT_EQ(2u, messages.size());
+
+  Owned<Message> decoded1(messages[0]);
+  EXPECT_EQ(message1.name, decoded1->name);
+  EXPECT_EQ(message1.from, decoded1->from);
+  EXPECT_EQ(message1.to, decoded1->to);
+  EXPECT_EQ(message1.body, decoded1->body);
+
+  Owned<Message> decoded2(messages[1]);
+  EXPECT_EQ(message2.name, decoded2->name);
+  EXPECT_EQ(message2.from, decoded2->from);
+  EXPECT_EQ(message2.to, decoded2->to);
+  EXPECT_EQ("", decoded2->body);
+}
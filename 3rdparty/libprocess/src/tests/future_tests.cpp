@@ -94,6 +94,47 @@ TEST(FutureTest, OnAny)
 }
 
 
+// Checks that the callbacks for each event are invoked in the order
+// they were installed, also when the discard callbacks get invoked
+// before the others.
+TEST(FutureTest, Callbacks)
+{
+  string order;
+
+  Promise<int> promise;
+  Future<int> future = promise.future();
+
+  future
+    .onAny([&order]() { order += "1"; })
+    .onDiscard([&order]() { order += "a"; })
+    .onReady([&order](int i) { order += std::to_string(i); })
+    .onFailed([&order]() { order += "x"; })
+    .onDiscard([&order]() { order += "b"; })
+    .onAny([&order](const Future<int>& f) {
+      order += std::to_string(f.get());
+    })
+    .onDiscarded([&order]() { order += "x"; })
+    .onReady([&order]() { order += "3"; });
+
+  future.discard();
+  EXPECT_EQ("ab", order);
+
+  // Discard callbacks installed after the discard run right away.
+  future.onDiscard([&order]() { order += "c"; });
+  EXPECT_EQ("abc", order);
+
+  promise.set(2);
+  EXPECT_EQ("abc2312", order);
+
+  // Callbacks installed once the future is ready run right away.
+  future
+    .onReady([&order]() { order += "4"; })
+    .onFailed([&order]() { order += "x"; })
+    .onAny([&order]() { order += "5"; });
+  EXPECT_EQ("abc231245", order);
+}
+
+
 static Future<string> itoa1(int* const& i)
 {
   std::ostringstream out;
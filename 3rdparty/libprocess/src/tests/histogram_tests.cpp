@@ -0,0 +1,191 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+
+#include <gtest/gtest.h>
+
+#include <math.h>
+
+#include <algorithm>
+#include <vector>
+
+#include <process/clock.hpp>
+#include <process/histogram.hpp>
+#include <process/statistics.hpp>
+
+#include <stout/duration.hpp>
+#include <stout/gtest.hpp>
+
+using process::Clock;
+using process::Histogram;
+using process::RollingHistogram;
+using process::Statistics;
+using process::Time;
+
+using std::vector;
+
+// Expects the value to be within the accuracy of the histogram.
+#define EXPECT_ACCURATE(expected, actual)                            \
+  EXPECT_NEAR(expected, actual, ::fabs(expected) * Histogram::ACCURACY)
+
+
+TEST(HistogramTest, Empty)
+{
+  Histogram histogram;
+
+  EXPECT_EQ(0u, histogram.count());
+  EXPECT_NONE(histogram.min());
+  EXPECT_NONE(histogram.max());
+  EXPECT_NONE(histogram.quantile(0.5));
+
+  EXPECT_NONE(Statistics<double>::from(histogram));
+
+  histogram.add(42);
+
+  EXPECT_SOME_EQ(42.0, histogram.quantile(0.5));
+  EXPECT_NONE(Statistics<double>::from(histogram));
+}
+
+
+TEST(HistogramTest, Statistics)
+{
+  // Create a distribution of 11 values from -5 to 5.
+  Histogram histogram;
+
+  for (int i = -5; i <= 5; ++i) {
+    histogram.add(i);
+  }
+
+  Option<Statistics<double>> statistics = Statistics<double>::from(histogram);
+
+  ASSERT_SOME(statistics);
+
+  EXPECT_EQ(11u, statistics->count);
+
+  EXPECT_DOUBLE_EQ(-5.0, statistics->min);
+  EXPECT_DOUBLE_EQ(5.0, statistics->max);
+
+  EXPECT_DOUBLE_EQ(0.0, statistics->p50);
+  EXPECT_ACCURATE(4.0, statistics->p90);
+  EXPECT_ACCURATE(4.5, statistics->p95);
+  EXPECT_ACCURATE(4.9, statistics->p99);
+  EXPECT_ACCURATE(4.99, statistics->p999);
+  EXPECT_ACCURATE(4.999, statistics->p9999);
+
+  EXPECT_ACCURATE(-4.0, histogram.quantile(0.1).get());
+}
+
+
+// Checks the quantiles of a large number of values spread over a few
+// orders of magnitude against the exact ones.
+TEST(HistogramTest, Quantiles)
+{
+  Histogram histogram;
+  vector<double> values;
+
+  for (int i = 1; i <= 100000; i++) {
+    const double value = ::pow(1.0001, i);
+    histogram.add(value);
+    values.push_back(value);
+  }
+
+  EXPECT_EQ(values.size(), histogram.count());
+
+  std::sort(values.begin(), values.end());
+
+  foreach (double q, vector<double>({0.01, 0.25, 0.5, 0.9, 0.99, 0.9999})) {
+    const size_t index = static_cast<size_t>(q * (values.size() - 1));
+    EXPECT_ACCURATE(values[index], histogram.quantile(q).get());
+  }
+
+  EXPECT_SOME_EQ(values.front(), histogram.quantile(0));
+  EXPECT_SOME_EQ(values.back(), histogram.quantile(1));
+}
+
+
+TEST(HistogramTest, Merge)
+{
+  Histogram histogram;
+  Histogram low;
+  Histogram high;
+
+  for (int i = 1; i <= 1000; i++) {
+    histogram.add(i);
+    (i <= 500 ? low : high).add(i);
+  }
+
+  Histogram merged;
+  merged.merge(high);
+  merged.merge(low);
+  merged.merge(Histogram());
+
+  EXPECT_EQ(histogram.count(), merged.count());
+  EXPECT_EQ(histogram.min(), merged.min());
+  EXPECT_EQ(histogram.max(), merged.max());
+
+  foreach (double q, vector<double>({0.1, 0.5, 0.9, 0.99})) {
+    EXPECT_EQ(histogram.quantile(q), merged.quantile(q));
+  }
+}
+
+
+// Checks that values whose magnitudes span more than what fits in
+// the buckets are all counted, at the expense of the accuracy of the
+// lowest quantiles only.
+TEST(HistogramTest, Collapse)
+{
+  Histogram histogram;
+
+  // 41 orders of magnitude, 100 values each.
+  for (int exponent = -20; exponent <= 20; exponent++) {
+    for (int i = 0; i < 100; i++) {
+      histogram.add(::pow(10, exponent));
+    }
+  }
+
+  EXPECT_EQ(4100u, histogram.count());
+  EXPECT_SOME_EQ(1e-20, histogram.min());
+  EXPECT_SOME_EQ(1e20, histogram.max());
+
+  // Only the highest (about 9) orders of magnitude stay accurate.
+  EXPECT_ACCURATE(1e20, histogram.quantile(0.999).get());
+  EXPECT_ACCURATE(1e15, histogram.quantile(3550.0 / 4099).get());
+  EXPECT_ACCURATE(1e12, histogram.quantile(3250.0 / 4099).get());
+}
+
+
+TEST(HistogramTest, Rolling)
+{
+  RollingHistogram histogram(Seconds(4), 4);
+
+  Time now = Clock::now();
+
+  histogram.add(1, now);
+  histogram.add(2, now + Seconds(1));
+  histogram.add(3, now + Seconds(2));
+
+  EXPECT_EQ(3u, histogram.get(now + Seconds(2)).count());
+
+  // The values expire one interval at a time.
+  EXPECT_EQ(3u, histogram.get(now + Seconds(3)).count());
+  EXPECT_EQ(2u, histogram.get(now + Seconds(4)).count());
+  EXPECT_EQ(1u, histogram.get(now + Seconds(5)).count());
+  EXPECT_EQ(0u, histogram.get(now + Seconds(6)).count());
+
+  // An interval is reused once it has left the window.
+  histogram.add(5, now + Seconds(5));
+
+  Histogram values = histogram.get(now + Seconds(5));
+  EXPECT_EQ(2u, values.count());
+  EXPECT_SOME_EQ(3.0, values.min());
+  EXPECT_SOME_EQ(5.0, values.max());
+}
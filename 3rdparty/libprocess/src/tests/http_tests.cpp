@@ -27,6 +27,7 @@
 
 #include <process/address.hpp>
 #include <process/authenticator.hpp>
+#include <process/clock.hpp>
 #include <process/future.hpp>
 #include <process/gmock.hpp>
 #include <process/gtest.hpp>
@@ -39,10 +40,13 @@
 #include <process/owned.hpp>
 #include <process/socket.hpp>
 
+#include <process/metrics/metrics.hpp>
+
 #include <process/ssl/gtest.hpp>
 
 #include <stout/base64.hpp>
 #include <stout/gtest.hpp>
+#include <stout/hashmap.hpp>
 #include <stout/hashset.hpp>
 #include <stout/none.hpp>
 #include <stout/nothing.hpp>
@@ -72,6 +76,7 @@ using authentication::JWTError;
 #endif // USE_SSL_SOCKET
 using authentication::Principal;
 
+using process::Clock;
 using process::Failure;
 using process::Future;
 using process::Owned;
@@ -772,6 +777,81 @@ TEST_P(HTTPTest, StreamingGetComplete)
 }
 
 
+// Tests that streamed responses which ask for it get compressed
+// when the client accepts it, chunk by chunk, and get decompressed
+// by the decoder.
+TEST_P(HTTPTest, StreamingGetCompressed)
+{
+  Http http;
+
+  foreach (const string& encoding, vector<string>({"gzip", "deflate"})) {
+    http::Pipe pipe;
+    http::OK ok;
+    ok.type = http::Response::PIPE;
+    ok.reader = pipe.reader();
+    ok.compress = true;
+
+    EXPECT_CALL(*http.process, pipe(_))
+      .WillOnce(Return(ok));
+
+    http::Headers headers;
+    headers["Accept-Encoding"] = encoding;
+
+    Future<http::Response> response = http::streaming::get(
+        http.process->self(), "pipe", None(), headers, GetParam());
+
+    AWAIT_READY(response);
+
+    EXPECT_SOME_EQ("chunked", response->headers.get("Transfer-Encoding"));
+    EXPECT_SOME_EQ(encoding, response->headers.get("Content-Encoding"));
+    ASSERT_EQ(http::Response::PIPE, response->type);
+    ASSERT_SOME(response->reader);
+
+    http::Pipe::Reader reader = response->reader.get();
+
+    // Every chunk can be read before the next one is written.
+    http::Pipe::Writer writer = pipe.writer();
+    EXPECT_TRUE(writer.write("hello"));
+    AWAIT_EQ("hello", reader.read());
+
+    EXPECT_TRUE(writer.write("goodbye"));
+    AWAIT_EQ("goodbye", reader.read());
+
+    EXPECT_TRUE(writer.close());
+    AWAIT_EQ("", reader.read()); // EOF.
+  }
+
+  // Streamed responses are not compressed unless they ask for it.
+  http::Pipe pipe;
+  http::OK ok;
+  ok.type = http::Response::PIPE;
+  ok.reader = pipe.reader();
+
+  EXPECT_CALL(*http.process, pipe(_))
+    .WillOnce(Return(ok));
+
+  http::Headers headers;
+  headers["Accept-Encoding"] = "gzip";
+
+  Future<http::Response> response = http::streaming::get(
+      http.process->self(), "pipe", None(), headers, GetParam());
+
+  AWAIT_READY(response);
+
+  EXPECT_NONE(response->headers.get("Content-Encoding"));
+  ASSERT_SOME(response->reader);
+
+  http::Pipe::Reader reader = response->reader.get();
+
+  http::Pipe::Writer writer = pipe.writer();
+  EXPECT_TRUE(writer.write("hello"));
+  AWAIT_EQ("hello", reader.read());
+
+  EXPECT_TRUE(writer.close());
+  AWAIT_EQ("", reader.read()); // EOF.
+}
+
+
 TEST_P(HTTPTest, StreamingGetFailure)
 {
   Http http;
@@ -1167,6 +1247,15 @@ TEST(HTTPConnectionTest, Pipeline)
 
   EXPECT_EQ("3", response3->body);
 
+  // The third request was enqueued while the responses to the first
+  // two were still outstanding.
+  Future<hashmap<string, double>> snapshot =
+    process::metrics::snapshot(None());
+
+  AWAIT_READY(snapshot);
+  ASSERT_TRUE(snapshot->contains("libprocess/http/pipelining_depth/max"));
+  EXPECT_LE(3.0, snapshot->at("libprocess/http/pipelining_depth/max"));
+
   // Disconnect.
   AWAIT_READY(connection.disconnect());
   AWAIT_READY(connection.disconnected());
@@ -1176,6 +1265,155 @@ TEST(HTTPConnectionTest, Pipeline)
 }
 
 
+// Tests that a connection pool reuses its connections, does not open
+// more than the maximum number of them and closes idle ones.
+TEST(HTTPConnectionPoolTest, Reuse)
+{
+  Http http;
+
+  http::URL url = http::URL(
+      "http",
+      http.process->self().address.ip,
+      http.process->self().address.port,
+      http.process->self().id + "/get");
+
+  http::ConnectionPool::Options options;
+  options.maxConnections = 1;
+
+  // Pool names must be unique, see the metrics below.
+  const string name = process::ID::generate("test");
+
+  http::ConnectionPool pool(name, options);
+
+  Promise<http::Response> promise1;
+  Future<http::Request> get1, get2;
+
+  EXPECT_CALL(*http.process, get(_))
+    .WillOnce(DoAll(FutureArg<0>(&get1),
+                    Return(promise1.future())))
+    .WillOnce(DoAll(FutureArg<0>(&get2),
+                    Return(http::OK("2"))));
+
+  http::Request request;
+  request.method = "GET";
+  request.url = url;
+
+  Future<http::Response> response1 = pool.send(request);
+  Future<http::Response> response2 = pool.send(request);
+
+  // The second request has to wait for the only connection.
+  AWAIT_READY(get1);
+  EXPECT_TRUE(get2.isPending());
+
+  promise1.set(http::OK("1"));
+
+  AWAIT_EXPECT_RESPONSE_BODY_EQ("1", response1);
+  AWAIT_EXPECT_RESPONSE_BODY_EQ("2", response2);
+
+  AWAIT_READY(get2);
+  ASSERT_SOME(get1->client);
+  EXPECT_SOME_EQ(get1->client.get(), get2->client);
+
+  Future<hashmap<string, double>> snapshot =
+    process::metrics::snapshot(None());
+
+  AWAIT_READY(snapshot);
+
+  const string prefix = "libprocess/http/connection_pools/" + name + "/";
+
+  EXPECT_EQ(1, snapshot->at(prefix + "misses"));
+  EXPECT_EQ(1, snapshot->at(prefix + "hits"));
+  EXPECT_EQ(1, snapshot->at(prefix + "connections"));
+
+  // The connection gets closed once it has been idle for long enough.
+  Clock::pause();
+  Clock::advance(options.idleTimeout);
+  Clock::settle();
+
+  snapshot = process::metrics::snapshot(None());
+
+  AWAIT_READY(snapshot);
+  EXPECT_EQ(0, snapshot->at(prefix + "connections"));
+
+  Clock::resume();
+}
+
+
+// Tests that a connection pool does not reuse a connection after a
+// "Connection: close" response, whatever its case, and that it retries
+// a request on a new connection when the server closed the idle
+// connection that the request was sent on.
+TEST(HTTPConnectionPoolTest, ServerClose)
+{
+  Try<Socket> server = Socket::create();
+  ASSERT_SOME(server);
+
+  ASSERT_SOME(server->bind(inet4::Address::ANY_ANY()));
+  ASSERT_SOME(server->listen(1));
+
+  Try<Address> any_address = server->address();
+  ASSERT_SOME(any_address);
+
+  // See `HttpServeTest.Pipelining` for why we don't use the address of
+  // the server socket.
+  Address address(process::address().ip, any_address->port);
+
+  http::Request request;
+  request.method = "GET";
+  request.url = http::URL("http", address.hostname().get(), address.port, "/");
+
+  // Reads a request from the socket, it only has headers.
+  auto receive = [](Socket socket) {
+    string data;
+    while (!strings::contains(data, "\r\n\r\n")) {
+      Future<string> received = socket.recv();
+      AWAIT_READY(received);
+      data += received.get();
+    }
+  };
+
+  const string ok = "HTTP/1.1 200 OK\r\nContent-Length: 0\r\n";
+
+  http::ConnectionPool pool(process::ID::generate("test"));
+
+  Future<Socket> accept = server->accept();
+  Future<http::Response> response = pool.send(request);
+
+  AWAIT_READY(accept);
+  Socket socket1 = accept.get();
+
+  receive(socket1);
+  AWAIT_READY(socket1.send(ok + "Connection: Close\r\n\r\n"));
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  // The next request gets a new connection.
+  accept = server->accept();
+  response = pool.send(request);
+
+  AWAIT_READY(accept);
+  Socket socket2 = accept.get();
+
+  receive(socket2);
+  AWAIT_READY(socket2.send(ok + "\r\n"));
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  // Close the connection, which is idle now, once the next request
+  // has been sent on it. The request is retried on a new connection.
+  accept = server->accept();
+  response = pool.send(request);
+
+  receive(socket2);
+  ASSERT_SOME(socket2.shutdown(Socket::Shutdown::READ_WRITE));
+
+  AWAIT_READY(accept);
+  Socket socket3 = accept.get();
+
+  receive(socket3);
+  AWAIT_READY(socket3.send(ok + "\r\n"));
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+}
+
+
 TEST(HTTPConnectionTest, ClosingRequest)
 {
   Http http;
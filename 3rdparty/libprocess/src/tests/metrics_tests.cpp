@@ -12,17 +12,23 @@
 
 #include <gtest/gtest.h>
 
+#include <functional>
 #include <map>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include <stout/base64.hpp>
 #include <stout/duration.hpp>
 #include <stout/gtest.hpp>
+#include <stout/os.hpp>
+#include <stout/strings.hpp>
 
 #include <process/authenticator.hpp>
 #include <process/clock.hpp>
 #include <process/future.hpp>
 #include <process/gtest.hpp>
+#include <process/histogram.hpp>
 #include <process/http.hpp>
 #include <process/process.hpp>
 #include <process/statistics.hpp>
@@ -31,6 +37,9 @@
 #include <process/metrics/counter.hpp>
 #include <process/metrics/gauge.hpp>
 #include <process/metrics/metrics.hpp>
+#include <process/metrics/push_gauge.hpp>
+#include <process/metrics/sharded_counter.hpp>
+#include <process/metrics/sharded_timer.hpp>
 #include <process/metrics/timer.hpp>
 
 namespace authentication = process::http::authentication;
@@ -47,19 +56,25 @@ using http::Unauthorized;
 
 using metrics::Counter;
 using metrics::Gauge;
+using metrics::PushGauge;
+using metrics::ShardedCounter;
+using metrics::ShardedTimer;
 using metrics::Timer;
 
 using process::Clock;
 using process::Failure;
 using process::Future;
+using process::Histogram;
 using process::PID;
 using process::Process;
 using process::READONLY_HTTP_AUTHENTICATION_REALM;
 using process::Statistics;
+using process::Time;
 using process::UPID;
 
 using std::map;
 using std::string;
+using std::vector;
 
 class GaugeProcess : public Process<GaugeProcess>
 {
@@ -165,6 +180,33 @@ TEST_F(MetricsTest, THREADSAFE_Gauge)
 }
 
 
+TEST_F(MetricsTest, PushGauge)
+{
+  PushGauge gauge("test/push_gauge");
+
+  AWAIT_READY(metrics::add(gauge));
+
+  AWAIT_EXPECT_EQ(0.0, gauge.value());
+
+  ++gauge;
+  AWAIT_EXPECT_EQ(1.0, gauge.value());
+
+  gauge += 42;
+  AWAIT_EXPECT_EQ(43.0, gauge.value());
+
+  --gauge;
+  AWAIT_EXPECT_EQ(42.0, gauge.value());
+
+  gauge -= 43;
+  AWAIT_EXPECT_EQ(-1.0, gauge.value());
+
+  gauge = 7;
+  AWAIT_EXPECT_EQ(7.0, gauge.value());
+
+  AWAIT_READY(metrics::remove(gauge));
+}
+
+
 TEST_F(MetricsTest, Statistics)
 {
   Counter counter("test/counter", process::TIME_SERIES_WINDOW);
@@ -188,12 +230,13 @@ TEST_F(MetricsTest, Statistics)
   EXPECT_FLOAT_EQ(0.0, statistics.get().min);
   EXPECT_FLOAT_EQ(10.0, statistics.get().max);
 
-  EXPECT_FLOAT_EQ(5.0, statistics.get().p50);
-  EXPECT_FLOAT_EQ(9.0, statistics.get().p90);
-  EXPECT_FLOAT_EQ(9.5, statistics.get().p95);
-  EXPECT_FLOAT_EQ(9.9, statistics.get().p99);
-  EXPECT_FLOAT_EQ(9.99, statistics.get().p999);
-  EXPECT_FLOAT_EQ(9.999, statistics.get().p9999);
+  // The percentiles are approximated by a histogram.
+  EXPECT_NEAR(5.0, statistics.get().p50, 5.0 * Histogram::ACCURACY);
+  EXPECT_NEAR(9.0, statistics.get().p90, 9.0 * Histogram::ACCURACY);
+  EXPECT_NEAR(9.5, statistics.get().p95, 9.5 * Histogram::ACCURACY);
+  EXPECT_NEAR(9.9, statistics.get().p99, 9.9 * Histogram::ACCURACY);
+  EXPECT_NEAR(9.99, statistics.get().p999, 9.99 * Histogram::ACCURACY);
+  EXPECT_NEAR(9.999, statistics.get().p9999, 9.999 * Histogram::ACCURACY);
 
   AWAIT_READY(metrics::remove(counter));
 }
@@ -438,15 +481,59 @@ TEST_F(MetricsTest, SnapshotStatistics)
   }
 
   // Ensure the expected keys are in the response and that the values match
-  // expectations.
+  // expectations (the percentiles are approximated by a histogram).
   foreachkey (const string& key, expected) {
-    EXPECT_FLOAT_EQ(expected[key], responseValues[key]);
+    EXPECT_NEAR(expected[key],
+                responseValues[key],
+                expected[key] * Histogram::ACCURACY);
   }
 
   AWAIT_READY(metrics::remove(counter));
 }
 
 
+TEST_F(MetricsTest, THREADSAFE_Prometheus)
+{
+  UPID upid("metrics", process::address());
+
+  Clock::pause();
+
+  GaugeProcess process;
+  PID<GaugeProcess> pid = spawn(&process);
+  ASSERT_TRUE(pid);
+
+  Gauge gauge("test/gauge", defer(pid, &GaugeProcess::get));
+  Gauge gaugeFail("test/gauge_fail", defer(pid, &GaugeProcess::fail));
+  Counter counter("test/counter-1");
+
+  AWAIT_READY(metrics::add(gauge));
+  AWAIT_READY(metrics::add(gaugeFail));
+  AWAIT_READY(metrics::add(counter));
+
+  counter += 3;
+
+  // Advance the clock to avoid rate limit.
+  Clock::advance(Seconds(1));
+
+  Future<Response> response = http::get(upid, "prometheus");
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(OK().status, response);
+  AWAIT_EXPECT_RESPONSE_HEADER_EQ(
+      "text/plain; version=0.0.4", "Content-Type", response);
+
+  // Names are sanitized and failed metrics are left out.
+  EXPECT_TRUE(strings::contains(response->body, "\ntest_gauge 42\n"));
+  EXPECT_TRUE(strings::contains(response->body, "\ntest_counter_1 3\n"));
+  EXPECT_FALSE(strings::contains(response->body, "test_gauge_fail"));
+
+  AWAIT_READY(metrics::remove(gauge));
+  AWAIT_READY(metrics::remove(gaugeFail));
+  AWAIT_READY(metrics::remove(counter));
+
+  terminate(process);
+  wait(process);
+}
+
+
 TEST_F(MetricsTest, Timer)
 {
   metrics::Timer<Nanoseconds> timer("test/timer");
@@ -474,6 +561,132 @@ TEST_F(MetricsTest, Timer)
 }
 
 
+TEST_F(MetricsTest, ShardedCounter)
+{
+  ShardedCounter counter("test/sharded_counter");
+
+  AWAIT_READY(metrics::add(counter));
+
+  AWAIT_EXPECT_EQ(0.0, counter.value());
+
+  ++counter;
+  counter++;
+  AWAIT_EXPECT_EQ(2.0, counter.value());
+
+  // Increment the counter from more threads than there are shards.
+  vector<std::thread> threads;
+  for (size_t i = 0; i < 2 * metrics::internal::SHARDS; i++) {
+    threads.emplace_back([&counter]() {
+      for (int j = 0; j < 1000; j++) {
+        ++counter;
+      }
+    });
+  }
+
+  foreach (std::thread& thread, threads) {
+    thread.join();
+  }
+
+  AWAIT_EXPECT_EQ(2.0 + 2 * metrics::internal::SHARDS * 1000, counter.value());
+
+  counter.reset();
+  AWAIT_EXPECT_EQ(0.0, counter.value());
+
+  counter += 42;
+  AWAIT_EXPECT_EQ(42.0, counter.value());
+
+  EXPECT_NONE(counter.statistics());
+
+  AWAIT_READY(metrics::remove(counter));
+}
+
+
+TEST_F(MetricsTest, ShardedTimer)
+{
+  ShardedTimer<Nanoseconds> timer(
+      "test/sharded_timer", process::TIME_SERIES_WINDOW);
+  EXPECT_EQ("test/sharded_timer_ns", timer.name());
+
+  AWAIT_READY(metrics::add(timer));
+
+  AWAIT_EXPECT_FAILED(timer.value());
+
+  Clock::pause();
+
+  // Time events from different threads, which record into different
+  // shards.
+  for (int i = 1; i <= 4; i++) {
+    std::thread thread([&timer, i]() {
+      const Time start = timer.start();
+      Clock::advance(Microseconds(i));
+      timer.stop(start);
+    });
+
+    thread.join();
+
+    AWAIT_EXPECT_EQ(Microseconds(i).ns(), timer.value());
+  }
+
+  Option<Statistics<double>> statistics = timer.statistics();
+  ASSERT_SOME(statistics);
+
+  EXPECT_EQ(4u, statistics->count);
+  EXPECT_FLOAT_EQ(Microseconds(1).ns(), statistics->min);
+  EXPECT_FLOAT_EQ(Microseconds(4).ns(), statistics->max);
+
+  AWAIT_READY(metrics::remove(timer));
+}
+
+
+// Tests that interleaved timings that are started and stopped on
+// different threads (e.g., by actors that moved between worker
+// threads) do not interfere with each other.
+TEST_F(MetricsTest, ShardedTimerInterleaved)
+{
+  ShardedTimer<Nanoseconds> timer(
+      "test/sharded_timer", process::TIME_SERIES_WINDOW);
+
+  AWAIT_READY(metrics::add(timer));
+
+  Clock::pause();
+
+  auto run = [](const std::function<void()>& f) {
+    std::thread thread(f);
+    thread.join();
+  };
+
+  Time start1;
+  Time start2;
+
+  run([&]() { start1 = timer.start(); });
+  Clock::advance(Microseconds(1));
+  run([&]() { start2 = timer.start(); });
+  Clock::advance(Microseconds(2));
+
+  // Stop the timings in the reverse order on other threads, and on
+  // the same thread as each other.
+  Nanoseconds duration2(0);
+  Nanoseconds duration1(0);
+
+  run([&]() {
+    duration2 = timer.stop(start2);
+    duration1 = timer.stop(start1);
+  });
+
+  EXPECT_EQ(Microseconds(2), duration2);
+  EXPECT_EQ(Microseconds(3), duration1);
+
+  Option<Statistics<double>> statistics = timer.statistics();
+  ASSERT_SOME(statistics);
+
+  EXPECT_EQ(2u, statistics->count);
+  EXPECT_FLOAT_EQ(Microseconds(2).ns(), statistics->min);
+  EXPECT_FLOAT_EQ(Microseconds(3).ns(), statistics->max);
+
+  AWAIT_READY(metrics::remove(timer));
+}
+
+
 static Future<int> advanceAndReturn()
 {
   Clock::advance(Seconds(1));
@@ -529,3 +742,115 @@ TEST_F(MetricsTest, THREADSAFE_SnapshotAuthenticationEnabled)
   Future<Response> response = http::get(upid, "snapshot");
   AWAIT_EXPECT_RESPONSE_STATUS_EQ(Unauthorized({}).status, response);
 }
+
+
+namespace process {
+
+// We need to reinitialize libprocess in order to test against different
+// configurations, such as when the metrics are sampled.
+void reinitialize(
+    const Option<string>& delegate,
+    const Option<string>& readonlyAuthenticationRealm,
+    const Option<string>& readwriteAuthenticationRealm);
+
+} // namespace process {
+
+
+class MetricsSamplingTest : public MetricsTest
+{
+protected:
+  virtual void SetUp()
+  {
+    os::setenv("LIBPROCESS_METRICS_SNAPSHOT_INTERVAL", "1secs");
+
+    process::reinitialize(
+        None(),
+        process::READWRITE_HTTP_AUTHENTICATION_REALM,
+        process::READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+
+  virtual void TearDown()
+  {
+    MetricsTest::TearDown();
+
+    os::unsetenv("LIBPROCESS_METRICS_SNAPSHOT_INTERVAL");
+
+    process::reinitialize(
+        None(),
+        process::READWRITE_HTTP_AUTHENTICATION_REALM,
+        process::READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+};
+
+
+// Tests that the endpoints serve the last sample of the metrics when
+// sampling is enabled, without waiting for metrics that are slow to
+// be evaluated.
+TEST_F(MetricsSamplingTest, THREADSAFE_Snapshot)
+{
+  UPID upid("metrics", process::address());
+
+  Clock::pause();
+
+  GaugeProcess process;
+  PID<GaugeProcess> pid = spawn(&process);
+  ASSERT_TRUE(pid);
+
+  Gauge gaugePending("test/gauge_pending", defer(pid, &GaugeProcess::pending));
+  Counter counter("test/counter");
+
+  AWAIT_READY(metrics::add(gaugePending));
+  AWAIT_READY(metrics::add(counter));
+
+  // Returns the value of the counter in the last sample served by the
+  // snapshot endpoint, or none if it is not in the sample.
+  auto sampled = [&]() -> Option<double> {
+    Future<Response> response = http::get(upid, "snapshot");
+    AWAIT_EXPECT_RESPONSE_STATUS_EQ(OK().status, response);
+
+    Try<JSON::Object> json = JSON::parse<JSON::Object>(response->body);
+    EXPECT_SOME(json);
+
+    EXPECT_EQ(0u, json->values.count("test/gauge_pending"));
+
+    Result<JSON::Number> value = json->at<JSON::Number>("test/counter");
+    EXPECT_FALSE(value.isError());
+
+    return value.isSome() ? value->as<double>() : Option<double>::none();
+  };
+
+  // The metrics were added after the first sample was taken.
+  EXPECT_NONE(sampled());
+
+  // The next sample is started after the interval and waits for the
+  // pending gauge for at most the interval.
+  Clock::advance(Seconds(1));
+  Clock::settle();
+  Clock::advance(Seconds(1));
+  Clock::settle();
+
+  EXPECT_SOME_EQ(0.0, sampled());
+
+  // The counter is only updated in the endpoint with the next sample.
+  ++counter;
+
+  EXPECT_SOME_EQ(0.0, sampled());
+
+  Clock::advance(Seconds(1));
+  Clock::settle();
+  Clock::advance(Seconds(1));
+  Clock::settle();
+
+  EXPECT_SOME_EQ(1.0, sampled());
+
+  // The Prometheus endpoint is served from the same sample.
+  Future<Response> response = http::get(upid, "prometheus");
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(OK().status, response);
+  EXPECT_TRUE(strings::contains(response->body, "\ntest_counter 1\n"));
+
+  AWAIT_READY(metrics::remove(gaugePending));
+  AWAIT_READY(metrics::remove(counter));
+
+  terminate(process);
+  wait(process);
+}
@@ -25,6 +25,7 @@
 #endif // __WINDOWS__
 
 #include <atomic>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -48,22 +49,29 @@
 #include <process/socket.hpp>
 #include <process/subprocess.hpp>
 #include <process/time.hpp>
+#include <process/timer.hpp>
+
+#include <process/metrics/metrics.hpp>
 
 #include <stout/duration.hpp>
 #include <stout/gtest.hpp>
 #include <stout/hashmap.hpp>
 #include <stout/hashset.hpp>
+#include <stout/json.hpp>
 #include <stout/lambda.hpp>
 #include <stout/nothing.hpp>
 #include <stout/os.hpp>
 #include <stout/stopwatch.hpp>
 #include <stout/stringify.hpp>
+#include <stout/synchronized.hpp>
 #include <stout/try.hpp>
 
 #include <stout/os/killtree.hpp>
 #include <stout/os/write.hpp>
 
+#include "decoder.hpp"
 #include "encoder.hpp"
+#include "run_queue.hpp"
 
 namespace http = process::http;
 namespace inject = process::inject;
@@ -81,14 +89,19 @@ using process::Future;
 using process::Message;
 using process::MessageEncoder;
 using process::MessageEvent;
+using process::MessageFrameDecoder;
+using process::MessageFrameEncoder;
 using process::Owned;
 using process::PID;
+using process::PriorityQueue;
+using process::Promise;
 using process::Process;
 using process::ProcessBase;
 using process::run;
 using process::Subprocess;
 using process::TerminateEvent;
 using process::Time;
+using process::Timer;
 using process::UPID;
 
 using process::firewall::DisabledEndpointsFirewallRule;
@@ -574,6 +587,105 @@ TEST(ProcessTest, THREADSAFE_Delay)
 }
 
 
+// Tests that timers fire in the order of their timeouts and that a
+// canceled timer never fires, including timers that are far enough
+// in the future that the clock needs to cascade them.
+TEST(ProcessTest, THREADSAFE_Timers)
+{
+  Clock::pause();
+
+  std::mutex mutex;
+  vector<int> fired;
+
+  auto timer = [&mutex, &fired](const Duration& duration, int i) {
+    return Clock::timer(duration, [&mutex, &fired, i]() {
+      synchronized (mutex) {
+        fired.push_back(i);
+      }
+    });
+  };
+
+  Timer timer1 = timer(Microseconds(500), 1);
+  timer(Milliseconds(1), 2);
+  timer(Milliseconds(300), 3);
+  timer(Milliseconds(300), 4);
+  timer(Days(60), 8);
+  timer(Hours(5), 6);
+  timer(Seconds(70), 5);
+  Timer timer7 = timer(Days(2), 7);
+
+  EXPECT_TRUE(Clock::cancel(timer7));
+  EXPECT_FALSE(Clock::cancel(timer7));
+
+  // Timers must not fire early even if they expire within the same
+  // millisecond as the current time.
+  Clock::advance(Microseconds(500));
+  Clock::settle();
+
+  synchronized (mutex) {
+    EXPECT_EQ(vector<int>({1}), fired);
+  }
+
+  EXPECT_FALSE(Clock::cancel(timer1));
+
+  Clock::advance(Milliseconds(1));
+  Clock::settle();
+
+  synchronized (mutex) {
+    EXPECT_EQ(vector<int>({1, 2}), fired);
+  }
+
+  Clock::advance(Days(61));
+  Clock::settle();
+
+  synchronized (mutex) {
+    EXPECT_EQ(vector<int>({1, 2, 3, 4, 5, 6, 8}), fired);
+  }
+
+  Clock::resume();
+}
+
+
+// Tests that timers created after the clock was advanced while paused
+// and then resumed (i.e., when the clock goes backwards) fire on time,
+// both when the clock has no other timers and when it still has some.
+TEST(ProcessTest, THREADSAFE_TimersAfterResume)
+{
+  Clock::pause();
+  Clock::advance(Days(1));
+  Clock::settle();
+  Clock::resume();
+
+  Promise<Nothing> promise1;
+  Clock::timer(Milliseconds(10), [&promise1]() {
+    promise1.set(Nothing());
+  });
+
+  AWAIT_READY(promise1.future());
+
+  Clock::pause();
+
+  Promise<Nothing> pending;
+  Timer timer = Clock::timer(Days(3), [&pending]() {
+    pending.set(Nothing());
+  });
+
+  Clock::advance(Days(1));
+  Clock::settle();
+  Clock::resume();
+
+  Promise<Nothing> promise2;
+  Clock::timer(Milliseconds(10), [&promise2]() {
+    promise2.set(Nothing());
+  });
+
+  AWAIT_READY(promise2.future());
+
+  EXPECT_TRUE(pending.future().isPending());
+  EXPECT_TRUE(Clock::cancel(timer));
+}
+
+
 class OrderProcess : public Process<OrderProcess>
 {
 public:
@@ -1466,6 +1578,369 @@ TEST_TEMP_DISABLED_ON_WINDOWS(ProcessTest, THREADSAFE_Http2)
 }
 
 
+namespace process {
+
+// We need to reinitialize libprocess in order to test against different
+// configurations, such as when binary message framing is enabled.
+void reinitialize(
+    const Option<string>& delegate,
+    const Option<string>& readonlyAuthenticationRealm,
+    const Option<string>& readwriteAuthenticationRealm);
+
+} // namespace process {
+
+
+class MessageFramingTest : public ::testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    os::setenv("LIBPROCESS_ENABLE_MESSAGE_FRAMING", "true");
+
+    process::reinitialize(
+        None(),
+        process::READWRITE_HTTP_AUTHENTICATION_REALM,
+        process::READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+
+  virtual void TearDown()
+  {
+    os::unsetenv("LIBPROCESS_ENABLE_MESSAGE_FRAMING");
+
+    process::reinitialize(
+        None(),
+        process::READWRITE_HTTP_AUTHENTICATION_REALM,
+        process::READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+
+  // Receives from `socket` until `delimiter` shows up, returning
+  // everything received up to that point.
+  static Future<string> receive(
+      Socket socket,
+      const string& delimiter,
+      const string& received = "")
+  {
+    if (received.find(delimiter) != string::npos) {
+      return received;
+    }
+
+    return socket.recv()
+      .then([=](const string& data) -> Future<string> {
+        if (data.empty()) {
+          return process::Failure("Socket closed");
+        }
+
+        return receive(socket, delimiter, received + data);
+      });
+  }
+
+  // Receives from `socket` until a whole message frame has arrived.
+  static Future<Message> receive(
+      Socket socket,
+      const Owned<MessageFrameDecoder>& decoder)
+  {
+    return socket.recv()
+      .then([=](const string& data) -> Future<Message> {
+        if (data.empty()) {
+          return process::Failure("Socket closed");
+        }
+
+        std::deque<Message*> messages =
+          decoder->decode(data.data(), data.size());
+
+        if (decoder->failed()) {
+          return process::Failure("Failed to decode message frame");
+        }
+
+        if (messages.empty()) {
+          return receive(socket, decoder);
+        }
+
+        CHECK_EQ(1u, messages.size());
+
+        Message message = std::move(*messages.front());
+        delete messages.front();
+        return message;
+      });
+  }
+};
+
+
+// Verifies that a link switches to binary message frames when the
+// peer agrees to, and that it negotiates again after relinking.
+TEST_F(MessageFramingTest, Link)
+{
+  Try<Socket> create = Socket::create();
+  ASSERT_SOME(create);
+
+  Socket server = create.get();
+
+  ASSERT_SOME(server.bind(inet4::Address::ANY_ANY()));
+  ASSERT_SOME(server.listen(1));
+
+  Try<Address> address = server.address();
+  ASSERT_SOME(address);
+
+  const UPID pid("receiver", process::address().ip, address->port);
+
+  RemoteLinkTestProcess process(pid);
+  spawn(process);
+
+  const string switching =
+    "HTTP/1.1 101 Switching Protocols\r\n"
+    "Connection: Upgrade\r\n"
+    "Upgrade: libprocess-frames/1\r\n"
+    "\r\n";
+
+  // Do this twice, since relinking creates a new socket.
+  for (int i = 0; i < 2; i++) {
+    Future<Socket> accept = server.accept();
+
+    if (i == 0) {
+      process.linkup();
+    } else {
+      process.relink();
+    }
+
+    // This message waits for the negotiation to finish.
+    process.ping_linkee();
+
+    AWAIT_READY(accept);
+    Socket client = accept.get();
+
+    Future<string> request = receive(client, "\r\n\r\n");
+    AWAIT_READY(request);
+    EXPECT_TRUE(strings::startsWith(request.get(), "GET "));
+    EXPECT_TRUE(strings::contains(
+        request.get(),
+        "Upgrade: libprocess-frames/1\r\n"));
+
+    AWAIT_READY(client.send(switching));
+
+    Owned<MessageFrameDecoder> decoder(new MessageFrameDecoder(pid.address));
+
+    Future<Message> message = receive(client, decoder);
+    AWAIT_READY(message);
+    EXPECT_EQ("whatever", message->name);
+    EXPECT_EQ(process.self(), message->from);
+    EXPECT_EQ(pid, message->to);
+
+    // Now that the link uses frames, messages get sent right away.
+    process.ping_linkee();
+
+    message = receive(client, decoder);
+    AWAIT_READY(message);
+    EXPECT_EQ("whatever", message->name);
+  }
+
+  terminate(process);
+  wait(process);
+}
+
+
+// Verifies that a link keeps using HTTP when the peer doesn't agree
+// to binary message frames, e.g., because it is an older version of
+// libprocess.
+TEST_F(MessageFramingTest, LinkFallback)
+{
+  Try<Socket> create = Socket::create();
+  ASSERT_SOME(create);
+
+  Socket server = create.get();
+
+  ASSERT_SOME(server.bind(inet4::Address::ANY_ANY()));
+  ASSERT_SOME(server.listen(1));
+
+  Try<Address> address = server.address();
+  ASSERT_SOME(address);
+
+  const UPID pid("receiver", process::address().ip, address->port);
+
+  RemoteLinkTestProcess process(pid);
+  spawn(process);
+
+  Future<Socket> accept = server.accept();
+
+  process.linkup();
+  process.ping_linkee();
+
+  AWAIT_READY(accept);
+  Socket client = accept.get();
+
+  Future<string> request = receive(client, "\r\n\r\n");
+  AWAIT_READY(request);
+
+  AWAIT_READY(client.send(
+      "HTTP/1.1 404 Not Found\r\n"
+      "Content-Length: 0\r\n"
+      "\r\n"));
+
+  request = receive(client, "\r\n\r\n");
+  AWAIT_READY(request);
+  EXPECT_TRUE(strings::startsWith(
+      request.get(),
+      "POST /receiver/whatever HTTP/1.1\r\n"));
+
+  terminate(process);
+  wait(process);
+}
+
+
+// Verifies that messages queued for a socket are sent together with a
+// single (vectored) send rather than one at a time, and that this
+// shows up in the /__sockets__ statistics. Messages sent while the
+// link negotiates binary message frames are queued deterministically.
+TEST_F(MessageFramingTest, LinkBatching)
+{
+  Try<Socket> create = Socket::create();
+  ASSERT_SOME(create);
+
+  Socket server = create.get();
+
+  ASSERT_SOME(server.bind(inet4::Address::ANY_ANY()));
+  ASSERT_SOME(server.listen(1));
+
+  Try<Address> address = server.address();
+  ASSERT_SOME(address);
+
+  const UPID pid("receiver", process::address().ip, address->port);
+
+  RemoteLinkTestProcess process(pid);
+  spawn(process);
+
+  Future<Socket> accept = server.accept();
+
+  process.linkup();
+
+  const size_t messages = 10;
+  for (size_t i = 0; i < messages; i++) {
+    process.ping_linkee();
+  }
+
+  // Make sure all of the messages are queued before the link finishes
+  // negotiating.
+  AWAIT_READY(dispatch(process.self(), []() { return Nothing(); }));
+
+  AWAIT_READY(accept);
+  Socket client = accept.get();
+
+  Future<string> request = receive(client, "\r\n\r\n");
+  AWAIT_READY(request);
+
+  AWAIT_READY(client.send(
+      "HTTP/1.1 101 Switching Protocols\r\n"
+      "Connection: Upgrade\r\n"
+      "Upgrade: libprocess-frames/1\r\n"
+      "\r\n"));
+
+  MessageFrameDecoder decoder(pid.address);
+
+  size_t received = 0;
+  while (received < messages) {
+    Future<string> data = client.recv();
+    AWAIT_READY(data);
+    ASSERT_FALSE(data->empty());
+
+    foreach (Message* message, decoder.decode(data->data(), data->size())) {
+      EXPECT_EQ("whatever", message->name);
+      delete message;
+      received++;
+    }
+
+    ASSERT_FALSE(decoder.failed());
+  }
+
+  EXPECT_EQ(messages, received);
+
+  Future<http::Response> response =
+    http::get(UPID("__sockets__", process::address()));
+
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  Try<JSON::Array> sockets = JSON::parse<JSON::Array>(response->body);
+  ASSERT_SOME(sockets);
+
+  Option<JSON::Object> link;
+  foreach (const JSON::Value& value, sockets->values) {
+    ASSERT_TRUE(value.is<JSON::Object>());
+
+    const JSON::Object& object = value.as<JSON::Object>();
+
+    Result<JSON::Boolean> persistent = object.find<JSON::Boolean>("link");
+    Result<JSON::String> peer = object.find<JSON::String>("peer");
+
+    if (persistent.isSome() && persistent->value &&
+        peer.isSome() && peer->value == stringify(pid.address)) {
+      link = object;
+    }
+  }
+
+  ASSERT_SOME(link);
+
+  // The request to switch to binary message frames is sent on its
+  // own, all of the messages are sent in one go.
+  EXPECT_SOME_EQ(JSON::Number(2), link->find<JSON::Number>("sends"));
+  EXPECT_SOME_EQ(
+      JSON::Number(messages + 1),
+      link->find<JSON::Number>("send_buffers"));
+  EXPECT_SOME_EQ(
+      JSON::Number(messages),
+      link->find<JSON::Number>("max_send_buffers"));
+
+  terminate(process);
+  wait(process);
+}
+
+
+// Verifies that libprocess switches an incoming connection to binary
+// message frames when asked to, and delivers the framed messages.
+TEST_F(MessageFramingTest, Receive)
+{
+  RemoteProcess process;
+  spawn(process);
+
+  Future<UPID> from;
+  Future<string> body;
+  EXPECT_CALL(process, handler(_, _))
+    .WillOnce(DoAll(FutureArg<0>(&from),
+                    FutureArg<1>(&body)));
+
+  Try<Socket> create = Socket::create();
+  ASSERT_SOME(create);
+
+  Socket socket = create.get();
+
+  AWAIT_READY(socket.connect(process.self().address));
+
+  Try<Address> address = socket.address();
+  ASSERT_SOME(address);
+
+  AWAIT_READY(socket.send(
+      "GET /__message_framing__ HTTP/1.1\r\n"
+      "Connection: Upgrade\r\n"
+      "Upgrade: libprocess-frames/1\r\n"
+      "\r\n"));
+
+  Future<string> response = receive(socket, "\r\n\r\n");
+  AWAIT_READY(response);
+  EXPECT_TRUE(strings::startsWith(response.get(), "HTTP/1.1 101 "));
+
+  Message message;
+  message.name = "handler";
+  message.from = UPID("sender", address.get());
+  message.to = process.self();
+  message.body = "hello world";
+
+  AWAIT_READY(socket.send(MessageFrameEncoder::encode(message)));
+
+  AWAIT_EXPECT_EQ(message.from, from);
+  AWAIT_EXPECT_EQ(message.body, body);
+
+  terminate(process);
+  wait(process);
+}
+
+
 static int foo()
 {
   return 1;
@@ -1974,3 +2449,390 @@ TEST_TEMP_DISABLED_ON_WINDOWS(ProcessTest, FirewallUninstall)
   terminate(process);
   wait(process);
 }
+
+
+class ProcessStatisticsTest : public ::testing::Test
+{
+protected:
+  virtual void SetUp()
+  {
+    os::setenv("LIBPROCESS_ENABLE_PROCESS_STATISTICS", "true");
+
+    process::reinitialize(
+        None(),
+        process::READWRITE_HTTP_AUTHENTICATION_REALM,
+        process::READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+
+  virtual void TearDown()
+  {
+    os::unsetenv("LIBPROCESS_ENABLE_PROCESS_STATISTICS");
+
+    process::reinitialize(
+        None(),
+        process::READWRITE_HTTP_AUTHENTICATION_REALM,
+        process::READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+};
+
+
+class StatisticsProcess : public Process<StatisticsProcess>
+{
+public:
+  StatisticsProcess() : ProcessBase("statistics") {}
+
+  void noop() {}
+
+  void sleep() { os::sleep(Milliseconds(10)); }
+};
+
+
+// Verifies that the statistics of a process show up in the
+// /__process_statistics__ endpoint and in the metrics.
+TEST_F(ProcessStatisticsTest, Statistics)
+{
+  StatisticsProcess process;
+  spawn(process);
+
+  for (int i = 0; i < 5; i++) {
+    dispatch(process, &StatisticsProcess::noop);
+  }
+
+  dispatch(process, &StatisticsProcess::sleep);
+
+  AWAIT_READY(dispatch(process.self(), []() { return Nothing(); }));
+
+  const UPID endpoint("__process_statistics__", process::address());
+
+  Future<http::Response> response = http::get(endpoint);
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  Try<JSON::Array> processes = JSON::parse<JSON::Array>(response->body);
+  ASSERT_SOME(processes);
+
+  Option<JSON::Object> statistics;
+  foreach (const JSON::Value& value, processes->values) {
+    ASSERT_TRUE(value.is<JSON::Object>());
+
+    const JSON::Object& object = value.as<JSON::Object>();
+
+    Result<JSON::String> id = object.find<JSON::String>("id");
+    if (id.isSome() && id->value == "statistics") {
+      statistics = object;
+    }
+  }
+
+  ASSERT_SOME(statistics);
+
+  EXPECT_SOME_EQ(
+      JSON::Number(7),
+      statistics->find<JSON::Number>("events_enqueued"));
+  EXPECT_SOME_EQ(
+      JSON::Number(7),
+      statistics->find<JSON::Number>("handlers.dispatch.count"));
+  EXPECT_SOME_EQ(
+      JSON::Number(0),
+      statistics->find<JSON::Number>("event_queue_size"));
+
+  Result<JSON::Number> time =
+    statistics->find<JSON::Number>("handlers.dispatch.time_max_ms");
+
+  ASSERT_SOME(time);
+  EXPECT_LE(10.0, time->as<double>());
+
+  // Limit the number of (busiest) processes returned.
+  response = http::get(endpoint, None(), "limit=1");
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  processes = JSON::parse<JSON::Array>(response->body);
+  ASSERT_SOME(processes);
+  EXPECT_EQ(1u, processes->values.size());
+
+  response = http::get(endpoint, None(), "sort=unknown");
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::BadRequest().status, response);
+
+  Future<hashmap<string, double>> snapshot =
+    process::metrics::snapshot(None());
+
+  AWAIT_READY(snapshot);
+
+  const string prefix = "libprocess/processes/statistics/";
+
+  EXPECT_SOME_EQ(7.0, snapshot->get(prefix + "events_enqueued"));
+  EXPECT_SOME_EQ(0.0, snapshot->get(prefix + "event_queue_size"));
+  EXPECT_TRUE(snapshot->contains(prefix + "dispatch_handler_time_ms"));
+
+  terminate(process);
+  wait(process);
+}
+
+
+// Verifies that the enqueue rate of a process reflects its recent
+// events rather than all of the events since it was spawned.
+TEST_F(ProcessStatisticsTest, EnqueueRate)
+{
+  Stopwatch stopwatch;
+  stopwatch.start();
+
+  StatisticsProcess process;
+  spawn(process);
+
+  // Let (at least) a whole window of the rate pass without events.
+  os::sleep(Milliseconds(1100));
+
+  for (int i = 0; i < 1000; i++) {
+    dispatch(process, &StatisticsProcess::noop);
+  }
+
+  os::sleep(Milliseconds(1100));
+
+  const UPID endpoint("__process_statistics__", process::address());
+
+  Future<http::Response> response =
+    http::get(endpoint, None(), "sort=enqueue_rate");
+
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  Try<JSON::Array> processes = JSON::parse<JSON::Array>(response->body);
+  ASSERT_SOME(processes);
+
+  Option<double> rate;
+  foreach (const JSON::Value& value, processes->values) {
+    ASSERT_TRUE(value.is<JSON::Object>());
+
+    const JSON::Object& object = value.as<JSON::Object>();
+
+    Result<JSON::String> id = object.find<JSON::String>("id");
+    if (id.isSome() && id->value == "statistics") {
+      Result<JSON::Number> number = object.find<JSON::Number>("enqueue_rate");
+      ASSERT_SOME(number);
+      rate = number->as<double>();
+    }
+  }
+
+  ASSERT_SOME(rate);
+
+  // This is (just about) the rate since the process was spawned,
+  // whereas the recent rate only covers the second half of that time.
+  const double lifetime = 1000 / stopwatch.elapsed().secs();
+
+  EXPECT_LT(1.5 * lifetime, rate.get());
+
+  response = http::get(endpoint, None(), "sort=event_queue_max_time");
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+
+  terminate(process);
+  wait(process);
+}
+
+
+class PriorityProcess : public ProcessBase
+{
+public:
+  explicit PriorityProcess(Priority priority)
+  {
+    prioritize(priority);
+  }
+};
+
+
+// Verifies that the run queue dequeues processes of a higher priority
+// first, in FIFO order within a priority, but never starves a process
+// of a lower priority.
+TEST(ProcessTest, Priority)
+{
+  PriorityProcess low(ProcessBase::Priority::LOW);
+  PriorityProcess normal(ProcessBase::Priority::NORMAL);
+  PriorityProcess high1(ProcessBase::Priority::HIGH);
+  PriorityProcess high2(ProcessBase::Priority::HIGH);
+
+  PriorityQueue queue;
+  EXPECT_TRUE(queue.empty());
+  EXPECT_EQ(nullptr, queue.pop());
+
+  queue.push(&low);
+  queue.push(&normal);
+  queue.push(&high1);
+  queue.push(&high2);
+
+  EXPECT_EQ(&high1, queue.pop());
+  EXPECT_EQ(&high2, queue.pop());
+  EXPECT_EQ(&normal, queue.pop());
+  EXPECT_EQ(&low, queue.pop());
+  EXPECT_TRUE(queue.empty());
+
+  // Keep the queue full of high priority processes, the low priority
+  // process must still get dequeued after at most `STARVATION_LIMIT`
+  // high priority ones.
+  queue.push(&low);
+  queue.push(&high1);
+  queue.push(&high2);
+
+  size_t passed = 0;
+  for (ProcessBase* process = queue.pop(); process != &low;
+       process = queue.pop()) {
+    ASSERT_NE(nullptr, process);
+    queue.push(process);
+    passed++;
+  }
+
+  EXPECT_EQ(process::STARVATION_LIMIT, passed);
+
+  EXPECT_TRUE(queue.extract(&high1));
+  EXPECT_FALSE(queue.extract(&low));
+  EXPECT_EQ(&high2, queue.pop());
+  EXPECT_TRUE(queue.empty());
+}
+
+
+class MailboxProcess : public Process<MailboxProcess>
+{
+public:
+  MailboxProcess(size_t capacity, Overflow overflow)
+  {
+    limit(capacity, overflow);
+    limit("reject", Overflow::REJECT);
+  }
+
+  // Blocks the process (and thus its mailbox) until 'future' is ready.
+  void block(const Future<Nothing>& future) { future.await(); }
+
+  size_t received() { return count; }
+
+protected:
+  virtual void initialize()
+  {
+    install("drop", &MailboxProcess::handler);
+    install("reject", &MailboxProcess::handler);
+    install("ping", &MailboxProcess::handler);
+  }
+
+private:
+  void handler(const UPID& from, const string& body) { count++; }
+
+  size_t count = 0;
+};
+
+
+class RejectedProcess : public Process<RejectedProcess>
+{
+public:
+  Future<string> rejected() { return promise.future(); }
+
+protected:
+  virtual void initialize()
+  {
+    install(ProcessBase::MAILBOX_FULL, &RejectedProcess::handler);
+  }
+
+private:
+  void handler(const UPID& from, const string& body) { promise.set(body); }
+
+  Promise<string> promise;
+};
+
+
+// Verifies that messages overflowing a limited mailbox get dropped or
+// rejected (i.e., the sender is told) depending on their policy.
+TEST(ProcessTest, MailboxOverflow)
+{
+  MailboxProcess process(1, ProcessBase::Overflow::DROP);
+  spawn(process);
+
+  RejectedProcess sender;
+  spawn(sender);
+
+  Promise<Nothing> unblock;
+  dispatch(process, &MailboxProcess::block, unblock.future());
+
+  post(sender.self(), process.self(), "drop", nullptr, 0);
+  post(sender.self(), process.self(), "drop", nullptr, 0);
+  post(sender.self(), process.self(), "reject", nullptr, 0);
+
+  AWAIT_EXPECT_EQ("reject", sender.rejected());
+
+  const string prefix = "libprocess/processes/" + process.self().id + "/";
+
+  Future<hashmap<string, double>> snapshot =
+    process::metrics::snapshot(None());
+
+  AWAIT_READY(snapshot);
+
+  EXPECT_SOME_EQ(1.0, snapshot->get(prefix + "mailbox/limit"));
+  EXPECT_SOME_EQ(1.0, snapshot->get(prefix + "mailbox/messages"));
+  EXPECT_SOME_EQ(1.0, snapshot->get(prefix + "mailbox/dropped"));
+  EXPECT_SOME_EQ(1.0, snapshot->get(prefix + "mailbox/rejected"));
+
+  unblock.set(Nothing());
+
+  AWAIT_EXPECT_EQ(1u, dispatch(process, &MailboxProcess::received));
+
+  terminate(sender);
+  wait(sender);
+
+  terminate(process);
+  wait(process);
+}
+
+
+// Verifies that a full mailbox that applies backpressure stops
+// libprocess from reading more messages from the connection.
+TEST(ProcessTest, THREADSAFE_MailboxBackpressure)
+{
+  MailboxProcess process(1, ProcessBase::Overflow::BACKPRESSURE);
+  spawn(process);
+
+  Promise<Nothing> unblock;
+  dispatch(process, &MailboxProcess::block, unblock.future());
+
+  http::URL url = http::URL(
+      "http",
+      process.self().address.ip,
+      process.self().address.port,
+      process.self().id + "/ping");
+
+  Future<http::Connection> connect = http::connect(url);
+  AWAIT_READY(connect);
+
+  http::Connection connection = connect.get();
+
+  http::Request request;
+  request.method = "POST";
+  request.url = url;
+  request.headers["Libprocess-From"] = stringify(UPID("sender", process.self().address));
+  request.keepAlive = true;
+
+  // The second message overflows the mailbox, i.e., it is enqueued
+  // but nothing else is read from the connection.
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(
+      http::Accepted().status, connection.send(request));
+
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(
+      http::Accepted().status, connection.send(request));
+
+  Future<http::Response> response = connection.send(request);
+
+  os::sleep(Milliseconds(50));
+  EXPECT_TRUE(response.isPending());
+
+  const string prefix = "libprocess/processes/" + process.self().id + "/";
+
+  Future<hashmap<string, double>> snapshot =
+    process::metrics::snapshot(None());
+
+  AWAIT_READY(snapshot);
+
+  EXPECT_SOME_EQ(2.0, snapshot->get(prefix + "mailbox/messages"));
+  EXPECT_SOME_EQ(1.0, snapshot->get(prefix + "mailbox/backpressured"));
+  EXPECT_SOME_EQ(0.0, snapshot->get(prefix + "mailbox/dropped"));
+
+  unblock.set(Nothing());
+
+  AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::Accepted().status, response);
+  AWAIT_EXPECT_EQ(3u, dispatch(process, &MailboxProcess::received));
+
+  AWAIT_READY(connection.disconnect());
+
+  terminate(process);
+  wait(process);
+}
@@ -17,22 +17,27 @@
 #include <process/future.hpp>
 #include <process/gtest.hpp>
 #include <process/http.hpp>
+#include <process/io.hpp>
 #include <process/process.hpp>
 #include <process/socket.hpp>
 
 #include <process/ssl/gtest.hpp>
 
 #include <stout/gtest.hpp>
+#include <stout/os.hpp>
+#include <stout/stringify.hpp>
 #include <stout/try.hpp>
 
 #include <stout/tests/utils.hpp>
 
+namespace http = process::http;
 namespace inet4 = process::network::inet4;
 #ifndef __WINDOWS__
 namespace unix = process::network::unix;
 #endif // __WINDOWS__
 
 using process::Future;
+using process::Process;
 using process::READONLY_HTTP_AUTHENTICATION_REALM;
 using process::READWRITE_HTTP_AUTHENTICATION_REALM;
 
@@ -243,4 +248,255 @@ TEST_P(NetSocketTest, EOFAfterRecv)
 
   AWAIT_EXPECT_EQ(string(), receive);
 }
+
+
+// Runs the tests with the I/O of sockets sharded across multiple event
+// loops. The environment and libprocess are restored in `TearDown()` so
+// that they do not leak into other tests if a test fails.
+class EventLoopsSocketTest : public TemporaryDirectoryTest
+{
+protected:
+  virtual void SetUp()
+  {
+    TemporaryDirectoryTest::SetUp();
+
+    os::setenv("LIBPROCESS_NUM_EVENT_LOOPS", "4");
+
+    process::reinitialize(
+        None(),
+        READWRITE_HTTP_AUTHENTICATION_REALM,
+        READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+
+  virtual void TearDown()
+  {
+    os::unsetenv("LIBPROCESS_NUM_EVENT_LOOPS");
+
+    process::reinitialize(
+        None(),
+        READWRITE_HTTP_AUTHENTICATION_REALM,
+        READONLY_HTTP_AUTHENTICATION_REALM);
+
+    TemporaryDirectoryTest::TearDown();
+  }
+};
+
+
+// This test verifies that sockets can send and receive when their
+// I/O is sharded across multiple event loops.
+TEST_F(EventLoopsSocketTest, SendRecv)
+{
+  Try<Socket> server = Socket::create();
+  ASSERT_SOME(server);
+
+  Try<Address> server_address = server->bind(inet4::Address::ANY_ANY());
+  ASSERT_SOME(server_address);
+
+  const int clients = 8;
+
+  ASSERT_SOME(server->listen(clients));
+
+  // Create enough connections so that (given sharding by file
+  // descriptor) every event loop has at least one socket.
+  for (int i = 0; i < clients; i++) {
+    Try<Socket> client = Socket::create();
+    ASSERT_SOME(client);
+
+    Future<Socket> accept = server->accept();
+
+    AWAIT_READY(
+        client->connect(Address(process::address().ip, server_address->port)));
+
+    AWAIT_READY(accept);
+
+    Socket socket = accept.get();
+
+    const string data = "Hello World " + stringify(i);
+
+    AWAIT_READY(client->send(data));
+    AWAIT_EXPECT_EQ(data, socket.recv(data.size()));
+
+    AWAIT_READY(socket.send(data));
+    AWAIT_EXPECT_EQ(data, client->recv(data.size()));
+  }
+}
 #endif // __WINDOWS__
+
+
+#ifdef __linux__
+// Runs the tests with `LIBPROCESS_ENABLE_IO_URING` set and multiple
+// event loops. If the kernel lacks io_uring support libprocess falls
+// back to poll and the tests are expected to pass just the same.
+class IoUringTest : public TemporaryDirectoryTest
+{
+protected:
+  virtual void SetUp()
+  {
+    TemporaryDirectoryTest::SetUp();
+
+    os::setenv("LIBPROCESS_ENABLE_IO_URING", "true");
+    os::setenv("LIBPROCESS_NUM_EVENT_LOOPS", "2");
+
+    process::reinitialize(
+        None(),
+        READWRITE_HTTP_AUTHENTICATION_REALM,
+        READONLY_HTTP_AUTHENTICATION_REALM);
+  }
+
+  virtual void TearDown()
+  {
+    os::unsetenv("LIBPROCESS_ENABLE_IO_URING");
+    os::unsetenv("LIBPROCESS_NUM_EVENT_LOOPS");
+
+    process::reinitialize(
+        None(),
+        READWRITE_HTTP_AUTHENTICATION_REALM,
+        READONLY_HTTP_AUTHENTICATION_REALM);
+
+    TemporaryDirectoryTest::TearDown();
+  }
+};
+
+
+TEST_F(IoUringTest, SendRecv)
+{
+  Try<Socket> server = Socket::create();
+  ASSERT_SOME(server);
+
+  Try<Address> server_address = server->bind(inet4::Address::ANY_ANY());
+  ASSERT_SOME(server_address);
+
+  ASSERT_SOME(server->listen(1));
+
+  Try<Socket> client = Socket::create();
+  ASSERT_SOME(client);
+
+  Future<Socket> accept = server->accept();
+
+  AWAIT_READY(
+      client->connect(Address(process::address().ip, server_address->port)));
+
+  AWAIT_READY(accept);
+
+  Socket socket = accept.get();
+
+  // Large enough to take more than one send and receive.
+  const string data(4 * 1024 * 1024, 'x');
+
+  Future<string> receive = socket.recv(data.size());
+
+  AWAIT_READY(client->send(data));
+  AWAIT_EXPECT_EQ(data, receive);
+
+  AWAIT_READY(socket.send("Hello World"));
+  AWAIT_EXPECT_EQ("Hello World", client->recv(11));
+
+  socket.shutdown(Socket::Shutdown::READ_WRITE);
+
+  AWAIT_EXPECT_EQ(string(), client->recv());
+}
+
+
+// This test verifies that closing a socket while a receive is
+// pending closes the connection, even though the kernel holds on to
+// the socket while the receive is in progress.
+TEST_F(IoUringTest, CloseWithPendingRecv)
+{
+  Try<Socket> server = Socket::create();
+  ASSERT_SOME(server);
+
+  Try<Address> server_address = server->bind(inet4::Address::ANY_ANY());
+  ASSERT_SOME(server_address);
+
+  ASSERT_SOME(server->listen(1));
+
+  Try<Socket> client = Socket::create();
+  ASSERT_SOME(client);
+
+  char data[16];
+  Future<size_t> receive;
+
+  {
+    Future<Socket> accept = server->accept();
+
+    AWAIT_READY(
+        client->connect(Address(process::address().ip, server_address->port)));
+
+    AWAIT_READY(accept);
+
+    Socket socket = accept.get();
+
+    receive = socket.recv(data, sizeof(data));
+  }
+
+  AWAIT_EXPECT_EQ(string(), client->recv());
+
+  EXPECT_TRUE(receive.isPending() || receive.isDiscarded());
+}
+
+
+class IoUringHttpProcess : public Process<IoUringHttpProcess>
+{
+public:
+  IoUringHttpProcess() : ProcessBase("io_uring") {}
+
+protected:
+  virtual void initialize()
+  {
+    route("/echo", None(), [](const http::Request& request) {
+      return http::OK(request.body);
+    });
+  }
+};
+
+
+TEST_F(IoUringTest, Http)
+{
+  IoUringHttpProcess process;
+  spawn(process);
+
+  const string body(1024 * 1024, 'x');
+
+  for (int i = 0; i < 3; i++) {
+    Future<http::Response> response =
+      http::post(process.self(), "echo", None(), body + stringify(i));
+
+    AWAIT_EXPECT_RESPONSE_STATUS_EQ(http::OK().status, response);
+    AWAIT_EXPECT_RESPONSE_BODY_EQ(body + stringify(i), response);
+  }
+
+  terminate(process);
+  wait(process);
+}
+
+
+TEST_F(IoUringTest, Pipe)
+{
+  int pipes[2];
+  ASSERT_NE(-1, ::pipe(pipes));
+
+  ASSERT_SOME(os::nonblock(pipes[0]));
+  ASSERT_SOME(os::nonblock(pipes[1]));
+
+  char data[16];
+
+  // Discarding a pending read cancels it.
+  Future<size_t> read = process::io::read(pipes[0], data, sizeof(data));
+
+  EXPECT_TRUE(read.isPending());
+
+  read.discard();
+
+  AWAIT_DISCARDED(read);
+
+  read = process::io::read(pipes[0], data, sizeof(data));
+
+  AWAIT_READY(process::io::write(pipes[1], "Hello"));
+  AWAIT_EXPECT_EQ(5u, read);
+
+  EXPECT_EQ("Hello", string(data, 5));
+
+  ASSERT_SOME(os::close(pipes[0]));
+  ASSERT_SOME(os::close(pipes[1]));
+}
+#endif // __linux__
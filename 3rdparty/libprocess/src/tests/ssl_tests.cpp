@@ -12,11 +12,14 @@
 
 #include <stdio.h>
 
+#include <iostream>
+#include <list>
 #include <map>
 #include <string>
 #include <vector>
 
 #include <process/clock.hpp>
+#include <process/collect.hpp>
 #include <process/future.hpp>
 #include <process/gtest.hpp>
 #include <process/http.hpp>
@@ -33,10 +36,14 @@
 #include <stout/nothing.hpp>
 #include <stout/option.hpp>
 #include <stout/os.hpp>
+#include <stout/stopwatch.hpp>
 #include <stout/try.hpp>
 
 #include "openssl.hpp"
 
+using std::cout;
+using std::endl;
+using std::list;
 using std::map;
 using std::string;
 using std::vector;
@@ -58,6 +65,7 @@ using network::inet::Socket;
 using network::internal::SocketImpl;
 
 using process::Clock;
+using process::collect;
 using process::Failure;
 using process::Future;
 using process::Subprocess;
@@ -922,4 +930,126 @@ TEST_F(SSLTest, ShutdownThenSend)
   AWAIT_FAILED(Socket(socket.get()).send("Hello World"));
 }
 
+// Ensures that reconnecting to the same server resumes the previous
+// TLS session instead of doing a full handshake, and that it doesn't
+// when session resumption is disabled.
+TEST_F(SSLTest, SessionResumption)
+{
+  foreach (const string& enabled, vector<string>({"true", "false"})) {
+    Try<Socket> server = setup_server({
+        {"LIBPROCESS_SSL_ENABLED", "true"},
+        {"LIBPROCESS_SSL_KEY_FILE", key_path().string()},
+        {"LIBPROCESS_SSL_CERT_FILE", certificate_path().string()},
+        {"LIBPROCESS_SSL_ENABLE_SESSION_RESUMPTION", enabled}});
+
+    ASSERT_SOME(server);
+
+    Try<Address> address = server->address();
+    ASSERT_SOME(address);
+
+    for (int i = 0; i < 2; i++) {
+      Try<Socket> client = Socket::create(SocketImpl::Kind::SSL);
+      ASSERT_SOME(client);
+
+      Future<Socket> socket = server->accept();
+
+      AWAIT_ASSERT_READY(client->connect(address.get()));
+      AWAIT_ASSERT_READY(socket);
+
+      // With TLS v1.3 the client only receives the session (ticket)
+      // along with the first data sent by the server.
+      AWAIT_ASSERT_READY(Socket(socket.get()).send(data));
+      AWAIT_ASSERT_EQ(data, client->recv(data.size()));
+    }
+
+    // NOTE: Both ends of a connection may count a resumed session
+    // since they share the same SSL context in this process.
+    if (enabled == "true") {
+      EXPECT_LT(0, SSL_CTX_sess_hits(openssl::context()));
+    } else {
+      EXPECT_EQ(0, SSL_CTX_sess_hits(openssl::context()));
+    }
+  }
+}
+
+
+class SSLReconnectBenchmark : public SSLTest {};
+
+
+INSTANTIATE_TEST_CASE_P(SessionResumption,
+                        SSLReconnectBenchmark,
+                        ::testing::Values("false", "true"));
+
+
+// Measures how long it takes a burst of clients to reconnect to a
+// server they were connected to before, e.g., agents reconnecting to
+// a failed over master, with and without session resumption.
+TEST_P(SSLReconnectBenchmark, BENCHMARK_ReconnectStorm)
+{
+  // NOTE: Each client uses two file descriptors in this process.
+  const size_t clients = 200;
+
+  set_environment_variables({
+      {"LIBPROCESS_SSL_ENABLED", "true"},
+      {"LIBPROCESS_SSL_KEY_FILE", key_path().string()},
+      {"LIBPROCESS_SSL_CERT_FILE", certificate_path().string()},
+      {"LIBPROCESS_SSL_ENABLE_SESSION_RESUMPTION", GetParam()}});
+
+  Try<Socket> server = Socket::create(SocketImpl::Kind::SSL);
+  ASSERT_SOME(server);
+
+  // NOTE: Unlike 'setup_server' we listen with a backlog that fits
+  // all the clients so that we don't measure SYN retransmissions.
+  ASSERT_SOME(server->bind(Address(net::IP(process::address().ip), 0)));
+  ASSERT_SOME(server->listen(clients));
+
+  Try<Address> address = server->address();
+  ASSERT_SOME(address);
+
+  // Connect once so that there is a session to resume.
+  {
+    Try<Socket> client = Socket::create(SocketImpl::Kind::SSL);
+    ASSERT_SOME(client);
+
+    Future<Socket> socket = server->accept();
+
+    AWAIT_ASSERT_READY(client->connect(address.get()));
+    AWAIT_ASSERT_READY(socket);
+
+    AWAIT_ASSERT_READY(Socket(socket.get()).send(data));
+    AWAIT_ASSERT_EQ(data, client->recv(data.size()));
+  }
+
+  vector<Socket> sockets;
+  list<Future<Nothing>> connects;
+
+  Stopwatch watch;
+  watch.start();
+
+  for (size_t i = 0; i < clients; i++) {
+    Try<Socket> client = Socket::create(SocketImpl::Kind::SSL);
+    ASSERT_SOME(client);
+
+    sockets.push_back(client.get());
+    connects.push_back(client->connect(address.get()));
+  }
+
+  AWAIT_ASSERT_READY_FOR(collect(connects), Seconds(60));
+
+  // The handshakes of the accepted sockets are completed before
+  // they are returned by 'accept'.
+  for (size_t i = 0; i < clients; i++) {
+    Future<Socket> socket = server->accept();
+    AWAIT_ASSERT_READY(socket);
+
+    sockets.push_back(socket.get());
+  }
+
+  watch.stop();
+
+  cout << "Reconnected " << clients << " clients in " << watch.elapsed()
+       << " with session resumption "
+       << (string(GetParam()) == "true" ? "enabled" : "disabled") << endl;
+}
+
 #endif // USE_SSL_SOCKET
@@ -0,0 +1,516 @@
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License
+
+#ifndef __PROCESS_TIMER_WHEEL_HPP__
+#define __PROCESS_TIMER_WHEEL_HPP__
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <glog/logging.h>
+
+#include <process/time.hpp>
+#include <process/timer.hpp>
+
+#include <stout/duration.hpp>
+#include <stout/foreach.hpp>
+#include <stout/option.hpp>
+
+namespace process {
+
+// A hierarchical timing wheel (see "Hashed and Hierarchical Timing
+// Wheels" by Varghese and Lauck) used by the `Clock` to store the
+// pending timers.
+//
+// Time is divided into "ticks" of `RESOLUTION` and the wheel has
+// `LEVELS` levels of `SLOTS` slots each. A timer is put in the
+// lowest level whose slots are coarse enough to cover how far in
+// the future (relative to the `cursor`) the timer expires, which
+// makes inserting a timer O(1). As the cursor moves forward the
+// timers in a slot of a higher level get "cascaded" down to the
+// lower levels until they end up in level 0 from where they expire.
+// Timers that expire beyond the range of the top level are kept in
+// an `overflow` list and timers that have already expired relative
+// to the cursor (which can happen when the clock is paused and a
+// process has its own notion of time) are kept in an `overdue`
+// list.
+//
+// Every timer is stored in an intrusive doubly linked list so that
+// with the index from timer ID to node we can cancel a timer in O(1)
+// without needing to know which slot it's in.
+//
+// Expiring timers costs O(number of expired timers) plus the number
+// of slots that we skip over, which we keep small by tracking which
+// slots are occupied in a bitmap. A timer is only ever expired when
+// its timeout is less than or equal to the time passed to `expire`
+// (not just when its tick has been reached) so the tick resolution
+// does not affect the precision of timers.
+//
+// NOTE: this is not thread-safe, the `Clock` serializes access.
+class TimerWheel
+{
+public:
+  TimerWheel()
+  {
+    for (size_t level = 0; level < LEVELS; level++) {
+      for (size_t index = 0; index < SLOTS; index++) {
+        slots[level][index].level = level;
+        slots[level][index].index = index;
+      }
+    }
+  }
+
+  TimerWheel(const TimerWheel&) = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  bool empty() const
+  {
+    return nodes.empty();
+  }
+
+  size_t size() const
+  {
+    return nodes.size();
+  }
+
+  // Moves the wheel to `now` when there are no timers so that new
+  // timers get placed relative to the current time rather than the
+  // time when the last timer expired.
+  //
+  // NOTE: this also moves the wheel backwards, e.g., after the clock
+  // was advanced while paused and then resumed, otherwise every new
+  // timer would end up in `overdue` until the wall clock caught up.
+  void advance(const Time& now)
+  {
+    CHECK(nodes.empty());
+    cursor = ticks(now);
+  }
+
+  // Adds a timer with the specified (unique) ID.
+  void insert(uint64_t id, const Timer& timer)
+  {
+    std::pair<std::unordered_map<uint64_t, Node>::iterator, bool> emplaced =
+      nodes.emplace(id, Node());
+
+    CHECK(emplaced.second) << "Timer " << id << " already exists";
+
+    Node* node = &emplaced.first->second;
+    node->id = id;
+    node->timer = timer;
+    node->tick = ticks(timer.timeout().time());
+
+    place(node);
+
+    // NOTE: if `cached` is none (and this is not the only timer)
+    // the earliest timeout still needs to be recomputed.
+    if ((cached.isSome() && timer.timeout().time() < cached.get()) ||
+        nodes.size() == 1) {
+      cached = timer.timeout().time();
+    }
+  }
+
+  // Removes the timer with the specified ID, returns false if there
+  // was no such timer (e.g., because it had already expired).
+  bool cancel(uint64_t id)
+  {
+    std::unordered_map<uint64_t, Node>::iterator it = nodes.find(id);
+    if (it == nodes.end()) {
+      return false;
+    }
+
+    Node* node = &it->second;
+
+    // Recompute the earliest timeout lazily if we're canceling the
+    // timer that expires first.
+    if (cached.isSome() && node->timer.timeout().time() <= cached.get()) {
+      cached = None();
+    }
+
+    unlink(node);
+    nodes.erase(it);
+
+    return true;
+  }
+
+  // Removes and returns all timers that have a timeout less than or
+  // equal to `now`, ordered by their timeout (and then by the order
+  // in which they were inserted).
+  std::list<Timer> expire(const Time& now)
+  {
+    std::vector<Node*> expired;
+
+    // The clock went backwards (e.g., it was resumed after having
+    // been advanced while paused) so move the cursor back with it.
+    const uint64_t target = ticks(now);
+    if (target < cursor) {
+      rewind(target);
+    }
+
+    // First take the overdue timers that have in fact expired. Note
+    // that a timer can be overdue relative to the cursor but not yet
+    // expired if the wall clock went backwards.
+    for (Node* node = overdue.head; node != nullptr;) {
+      Node* next = node->next;
+      if (node->timer.timeout().time() <= now) {
+        unlink(node);
+        expired.push_back(node);
+      }
+      node = next;
+    }
+
+    // Now move the cursor forward to `now`, one occupied slot at a
+    // time, cascading the timers in the higher levels as we go.
+    while (true) {
+      Option<std::pair<uint64_t, Slot*>> event = next();
+
+      if (event.isNone() || event->first > target) {
+        break;
+      }
+
+      cursor = event->first;
+
+      Slot* slot = event->second;
+
+      if (slot == &overflow) {
+        // We've moved into a new range of the top level so put all
+        // the overflowed timers back in the wheel (some of which
+        // may just overflow again).
+        cascade(slot);
+      } else if (slot->level > 0) {
+        cascade(slot);
+      } else {
+        // NOTE: all timers in a level 0 slot expire in the same tick
+        // but if that's the tick of `now` some may not expire yet.
+        for (Node* node = slot->head; node != nullptr;) {
+          Node* next = node->next;
+          if (node->timer.timeout().time() <= now) {
+            unlink(node);
+            expired.push_back(node);
+          }
+          node = next;
+        }
+
+        // Any remaining timers will expire in a later call.
+        if (cursor == target) {
+          break;
+        }
+      }
+    }
+
+    cursor = std::max(cursor, target);
+
+    std::sort(
+        expired.begin(),
+        expired.end(),
+        [](const Node* left, const Node* right) {
+          if (left->timer.timeout().time() == right->timer.timeout().time()) {
+            return left->id < right->id;
+          }
+          return left->timer.timeout().time() < right->timer.timeout().time();
+        });
+
+    std::list<Timer> timers;
+
+    foreach (Node* node, expired) {
+      timers.push_back(std::move(node->timer));
+      nodes.erase(node->id);
+    }
+
+    if (!timers.empty()) {
+      cached = None();
+    }
+
+    return timers;
+  }
+
+  // Returns the timeout of the timer that expires first, if any.
+  Option<Time> earliest()
+  {
+    if (nodes.empty()) {
+      return None();
+    }
+
+    if (cached.isSome()) {
+      return cached;
+    }
+
+    // NOTE: overdue timers might have a timeout that is later than
+    // the timers in the wheel if the wall clock went backwards.
+    Option<Time> result = earliest(overdue);
+
+    // All timers in the next occupied slot expire before any of the
+    // timers in the other slots, see `next`.
+    Option<std::pair<uint64_t, Slot*>> event = next();
+    if (event.isSome()) {
+      Option<Time> time = earliest(*event->second);
+      if (result.isNone() || (time.isSome() && time.get() < result.get())) {
+        result = time;
+      }
+    }
+
+    CHECK_SOME(result);
+
+    cached = result;
+
+    return result;
+  }
+
+  void clear()
+  {
+    for (size_t level = 0; level < LEVELS; level++) {
+      for (size_t index = 0; index < SLOTS; index++) {
+        slots[level][index].head = nullptr;
+      }
+      for (size_t word = 0; word < WORDS; word++) {
+        occupied[level][word] = 0;
+      }
+    }
+
+    overdue.head = nullptr;
+    overflow.head = nullptr;
+
+    nodes.clear();
+    cached = None();
+  }
+
+private:
+  static constexpr size_t BITS = 8;
+  static constexpr size_t SLOTS = 1 << BITS;
+  static constexpr size_t LEVELS = 4;
+  static constexpr size_t WORDS = SLOTS / 64;
+
+  // NOTE: with 4 levels of 256 slots of 1 millisecond the wheel
+  // spans ~49 days, anything further in the future overflows.
+  static uint64_t ticks(const Time& time)
+  {
+    const int64_t ns = time.duration().ns();
+    return ns < 0 ? 0 : static_cast<uint64_t>(ns) / RESOLUTION;
+  }
+
+  static constexpr uint64_t RESOLUTION = 1000000; // 1 millisecond in ns.
+
+  struct Slot;
+
+  struct Node
+  {
+    uint64_t id = 0;
+    Timer timer;
+    uint64_t tick = 0;
+
+    Node* prev = nullptr;
+    Node* next = nullptr;
+    Slot* slot = nullptr;
+  };
+
+  struct Slot
+  {
+    Node* head = nullptr;
+
+    // Position in the wheel, a level of -1 is used for the overdue
+    // and overflow lists.
+    int level = -1;
+    size_t index = 0;
+  };
+
+  // Puts the node in the slot that corresponds to its tick relative
+  // to the cursor, i.e., the highest level in which the tick and the
+  // cursor differ.
+  void place(Node* node)
+  {
+    Slot* slot = nullptr;
+
+    if (node->tick < cursor) {
+      slot = &overdue;
+    } else {
+      const uint64_t difference = node->tick ^ cursor;
+
+      int level = 0;
+      while (level < (int) LEVELS && (difference >> (BITS * (level + 1)))) {
+        level++;
+      }
+
+      if (level == (int) LEVELS) {
+        slot = &overflow;
+      } else {
+        slot = &slots[level][(node->tick >> (BITS * level)) & (SLOTS - 1)];
+      }
+    }
+
+    node->slot = slot;
+    node->prev = nullptr;
+    node->next = slot->head;
+    if (slot->head != nullptr) {
+      slot->head->prev = node;
+    }
+    slot->head = node;
+
+    if (slot->level >= 0) {
+      occupied[slot->level][slot->index / 64] |=
+        uint64_t(1) << (slot->index % 64);
+    }
+  }
+
+  void unlink(Node* node)
+  {
+    Slot* slot = node->slot;
+
+    if (node->prev != nullptr) {
+      node->prev->next = node->next;
+    } else {
+      slot->head = node->next;
+    }
+
+    if (node->next != nullptr) {
+      node->next->prev = node->prev;
+    }
+
+    if (slot->head == nullptr && slot->level >= 0) {
+      occupied[slot->level][slot->index / 64] &=
+        ~(uint64_t(1) << (slot->index % 64));
+    }
+
+    node->prev = node->next = nullptr;
+    node->slot = nullptr;
+  }
+
+  // Re-places all of the timers in the slot relative to the cursor.
+  void cascade(Slot* slot)
+  {
+    Node* node = slot->head;
+
+    slot->head = nullptr;
+    if (slot->level >= 0) {
+      occupied[slot->level][slot->index / 64] &=
+        ~(uint64_t(1) << (slot->index % 64));
+    }
+
+    while (node != nullptr) {
+      Node* next = node->next;
+      place(node);
+      node = next;
+    }
+  }
+
+  // Moves the cursor back to `tick` and re-places all of the timers
+  // relative to it. This is O(number of timers) but only happens when
+  // the clock goes backwards.
+  void rewind(uint64_t tick)
+  {
+    cursor = tick;
+
+    foreachvalue (Node& node, nodes) {
+      unlink(&node);
+    }
+
+    foreachvalue (Node& node, nodes) {
+      place(&node);
+    }
+  }
+
+  // Returns the index of the first occupied slot in the level at or
+  // after `index`, if any.
+  Option<size_t> find(size_t level, size_t index) const
+  {
+    for (size_t word = index / 64; word < WORDS; word++) {
+      uint64_t bits = occupied[level][word];
+
+      // Ignore the slots before `index` in the first word.
+      if (word == index / 64) {
+        bits &= ~uint64_t(0) << (index % 64);
+      }
+
+      if (bits != 0) {
+        size_t bit = 0;
+        while ((bits & 1) == 0) {
+          bits >>= 1;
+          bit++;
+        }
+        return word * 64 + bit;
+      }
+    }
+
+    return None();
+  }
+
+  // Returns the tick at which the cursor next needs to stop, along
+  // with the slot that needs to be expired or cascaded at that tick.
+  //
+  // Because a timer is placed at the highest level in which its tick
+  // differs from the cursor, the occupied slots of each level (other
+  // than level 0) come after the cursor's own position in that level
+  // and all of the timers in an earlier level expire before those in
+  // a later level. Thus the first occupied slot we find, starting
+  // from level 0, is the next one.
+  Option<std::pair<uint64_t, Slot*>> next()
+  {
+    for (size_t level = 0; level < LEVELS; level++) {
+      const size_t shift = BITS * level;
+      const size_t position = (cursor >> shift) & (SLOTS - 1);
+
+      // NOTE: in level 0 the slot of the cursor itself might still
+      // have timers that have not expired yet.
+      Option<size_t> index = find(level, level == 0 ? position : position + 1);
+
+      if (index.isSome()) {
+        const uint64_t base = (cursor >> (shift + BITS)) << (shift + BITS);
+        return std::make_pair(
+            base | (uint64_t(index.get()) << shift),
+            &slots[level][index.get()]);
+      }
+
+    }
+
+    if (overflow.head != nullptr) {
+      const size_t shift = BITS * LEVELS;
+      return std::make_pair(((cursor >> shift) + 1) << shift, &overflow);
+    }
+
+    return None();
+  }
+
+  static Option<Time> earliest(const Slot& slot)
+  {
+    Option<Time> result;
+    for (Node* node = slot.head; node != nullptr; node = node->next) {
+      if (result.isNone() || node->timer.timeout().time() < result.get()) {
+        result = node->timer.timeout().time();
+      }
+    }
+    return result;
+  }
+
+  Slot slots[LEVELS][SLOTS];
+  uint64_t occupied[LEVELS][WORDS] = {};
+
+  Slot overdue;
+  Slot overflow;
+
+  // All timers by ID, we rely on `std::unordered_map` never moving
+  // its elements so we can link the nodes directly.
+  std::unordered_map<uint64_t, Node> nodes;
+
+  // All timers with a tick before the cursor have been expired (or
+  // are in `overdue`).
+  uint64_t cursor = 0;
+
+  // Cached result of `earliest`.
+  Option<Time> cached;
+};
+
+} // namespace process {
+
+#endif // __PROCESS_TIMER_WHEEL_HPP__
@@ -25,7 +25,6 @@
 
 
 // Compression utilities.
-// TODO(bmahler): Provide streaming compression as well.
 namespace gzip {
 
 namespace internal {
@@ -88,7 +87,13 @@ private:
 class Decompressor
 {
 public:
-  Decompressor()
+  enum Format
+  {
+    GZIP,
+    ZLIB // What HTTP calls the "deflate" content coding.
+  };
+
+  explicit Decompressor(Format format = GZIP)
     : _finished(false)
   {
     stream.zalloc = Z_NULL;
@@ -99,7 +104,9 @@ public:
 
     int code = inflateInit2(
         &stream,
-        MAX_WBITS + 16); // Zlib magic for gzip compression / decompression.
+        format == GZIP
+          ? MAX_WBITS + 16 // Zlib magic for gzip compression / decompression.
+          : MAX_WBITS);
 
     if (code != Z_OK) {
       Error error = internal::GzipError("Failed to inflateInit2", stream, code);
@@ -169,13 +176,134 @@ private:
 };
 
 
+// Provides the ability to incrementally compress
+// a stream of input data.
+class Compressor
+{
+public:
+  enum Format
+  {
+    GZIP,
+    ZLIB // What HTTP calls the "deflate" content coding.
+  };
+
+  // The compression level should be within the range [-1, 9].
+  // See zlib.h:
+  //   #define Z_NO_COMPRESSION         0
+  //   #define Z_BEST_SPEED             1
+  //   #define Z_BEST_COMPRESSION       9
+  //   #define Z_DEFAULT_COMPRESSION  (-1)
+  explicit Compressor(int level = Z_DEFAULT_COMPRESSION, Format format = GZIP)
+    : _finished(false)
+  {
+    stream.zalloc = Z_NULL;
+    stream.zfree = Z_NULL;
+    stream.opaque = Z_NULL;
+    stream.next_in = Z_NULL;
+    stream.avail_in = 0;
+
+    int code = deflateInit2(
+        &stream,
+        level,          // Compression level.
+        Z_DEFLATED,     // Compression method.
+        format == GZIP
+          ? MAX_WBITS + 16 // Zlib magic for gzip compression.
+          : MAX_WBITS,
+        8,              // Default memLevel value.
+        Z_DEFAULT_STRATEGY);
+
+    if (code != Z_OK) {
+      Error error = internal::GzipError("Failed to deflateInit2", stream, code);
+      ABORT(error.message);
+    }
+  }
+
+  Compressor(const Compressor&) = delete;
+  Compressor& operator=(const Compressor&) = delete;
+
+  ~Compressor()
+  {
+    // NOTE: `deflateEnd` returns `Z_DATA_ERROR` if the stream was not
+    // finished, which is fine.
+    int code = deflateEnd(&stream);
+    if (code != Z_OK && code != Z_DATA_ERROR) {
+      ABORT("Failed to deflateEnd");
+    }
+  }
+
+  // Returns the next compressed chunk of data, or an Error if
+  // compression fails. The input is flushed, i.e., everything that
+  // has been compressed so far can be decompressed from the chunks
+  // returned so far.
+  Try<std::string> compress(const std::string& decompressed)
+  {
+    return _compress(decompressed, Z_SYNC_FLUSH);
+  }
+
+  // Returns the last compressed chunk of data, including any
+  // remaining input, or an Error if compression fails.
+  Try<std::string> finish(const std::string& decompressed = "")
+  {
+    return _compress(decompressed, Z_FINISH);
+  }
+
+  // Returns whether the compression stream is finished.
+  bool finished() const
+  {
+    return _finished;
+  }
+
+private:
+  Try<std::string> _compress(const std::string& decompressed, int flush)
+  {
+    if (_finished) {
+      return Error("Stream is already finished");
+    }
+
+    stream.next_in =
+      const_cast<Bytef*>(reinterpret_cast<const Bytef*>(decompressed.data()));
+    stream.avail_in = static_cast<uInt>(decompressed.length());
+
+    // Build up the compressed result.
+    Bytef buffer[GZIP_BUFFER_SIZE];
+    std::string result;
+    int code;
+
+    // We are done once zlib does not fill up the buffer anymore (or
+    // ends the stream when finishing).
+    do {
+      stream.next_out = buffer;
+      stream.avail_out = GZIP_BUFFER_SIZE;
+
+      code = ::deflate(&stream, flush);
+
+      // NOTE: `Z_BUF_ERROR` means no progress was possible, e.g., if
+      // all the output fit into the previous buffer exactly.
+      if (code != Z_OK && code != Z_STREAM_END && code != Z_BUF_ERROR) {
+        return internal::GzipError("Failed to deflate", stream, code);
+      }
+
+      // Consume output.
+      result.append(
+          reinterpret_cast<char*>(buffer),
+          GZIP_BUFFER_SIZE - stream.avail_out);
+    } while (flush == Z_FINISH
+               ? code != Z_STREAM_END
+               : stream.avail_out == 0);
+
+    _finished = code == Z_STREAM_END;
+
+    return result;
+  }
+
+  z_stream_s stream;
+  bool _finished;
+};
+
+
 // Returns a gzip compressed version of the provided string.
-// The compression level should be within the range [-1, 9].
-// See zlib.h:
-//   #define Z_NO_COMPRESSION         0
-//   #define Z_BEST_SPEED             1
-//   #define Z_BEST_COMPRESSION       9
-//   #define Z_DEFAULT_COMPRESSION  (-1)
+// The compression level should be within the range [-1, 9],
+// see `Compressor`.
 inline Try<std::string> compress(
     const std::string& decompressed,
     int level = Z_DEFAULT_COMPRESSION)
@@ -186,63 +314,17 @@ inline Try<std::string> compress(
     return Error("Invalid compression level: " + stringify(level));
   }
 
-  z_stream_s stream;
-  stream.next_in =
-    const_cast<Bytef*>(reinterpret_cast<const Bytef*>(decompressed.data()));
-  stream.avail_in = static_cast<uInt>(decompressed.length());
-  stream.zalloc = Z_NULL;
-  stream.zfree = Z_NULL;
-  stream.opaque = Z_NULL;
-
-  int code = deflateInit2(
-      &stream,
-      level,          // Compression level.
-      Z_DEFLATED,     // Compression method.
-      MAX_WBITS + 16, // Zlib magic for gzip compression / decompression.
-      8,              // Default memLevel value.
-      Z_DEFAULT_STRATEGY);
-
-  if (code != Z_OK) {
-    Error error = internal::GzipError("Failed to deflateInit2", stream, code);
-    ABORT(error.message);
-  }
-
-  // Build up the compressed result.
-  Bytef buffer[GZIP_BUFFER_SIZE];
-  std::string result;
-  do {
-    stream.next_out = buffer;
-    stream.avail_out = GZIP_BUFFER_SIZE;
-    code = deflate(&stream, stream.avail_in > 0 ? Z_NO_FLUSH : Z_FINISH);
-
-    if (code != Z_OK && code != Z_STREAM_END) {
-      Error error = internal::GzipError("Failed to deflate", stream, code);
-      if (deflateEnd(&stream) != Z_OK) {
-        ABORT("Failed to deflateEnd");
-      }
-      return error;
-    }
-
-    // Consume output and reset the buffer.
-    result.append(
-        reinterpret_cast<char*>(buffer),
-        GZIP_BUFFER_SIZE - stream.avail_out);
-    stream.next_out = buffer;
-    stream.avail_out = GZIP_BUFFER_SIZE;
-  } while (code != Z_STREAM_END);
-
-  if (deflateEnd(&stream) != Z_OK) {
-    ABORT("Failed to deflateEnd");
-  }
-
-  return result;
+  return Compressor(level).finish(decompressed);
 }
 
 
-// Returns a gzip decompressed version of the provided string.
-inline Try<std::string> decompress(const std::string& compressed)
+// Returns a decompressed version of the provided string, which is
+// gzip compressed unless specified otherwise.
+inline Try<std::string> decompress(
+    const std::string& compressed,
+    Decompressor::Format format = Decompressor::GZIP)
 {
-  Decompressor decompressor;
+  Decompressor decompressor(format);
   Try<std::string> decompressed = decompressor.decompress(compressed);
 
   // Ensure that the decompression stream does not expect more input.
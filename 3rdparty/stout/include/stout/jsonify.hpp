@@ -465,6 +465,44 @@ private:
 };
 
 
+// The raw writer. `set(json)` is used to write an already serialized
+// JSON value verbatim, e.g., to reuse the serialization of a value that
+// did not change. If `set` is not called at all, `null` is printed.
+//
+// NOTE: The value is not validated, the caller is responsible for it
+// being valid JSON.
+class RawWriter
+{
+public:
+  RawWriter(std::ostream* stream) : stream_(stream), set_(false) {}
+
+  RawWriter(const RawWriter&) = delete;
+  RawWriter(RawWriter&&) = delete;
+
+  ~RawWriter()
+  {
+    if (!set_) {
+      *stream_ << "null";
+    }
+  }
+
+  RawWriter& operator=(const RawWriter&) = delete;
+  RawWriter& operator=(RawWriter&&) = delete;
+
+  void set(const std::string& json)
+  {
+    if (!set_) {
+      *stream_ << json;
+      set_ = true;
+    }
+  }
+
+private:
+  std::ostream* stream_;
+  bool set_;
+};
+
+
 // `json` function for boolean.
 inline void json(BooleanWriter* writer, bool value) { writer->set(value); }
 
@@ -671,6 +709,10 @@ public:
         writer_.null_writer.~NullWriter();
         break;
       }
+      case RAW_WRITER: {
+        writer_.raw_writer.~RawWriter();
+        break;
+      }
     }
   }
 
@@ -716,6 +758,13 @@ public:
     return &writer_.null_writer;
   }
 
+  operator RawWriter*() &&
+  {
+    new (&writer_.raw_writer) RawWriter(stream_);
+    type_ = RAW_WRITER;
+    return &writer_.raw_writer;
+  }
+
 private:
   enum Type
   {
@@ -724,7 +773,8 @@ private:
     STRING_WRITER,
     ARRAY_WRITER,
     OBJECT_WRITER,
-    NULL_WRITER
+    NULL_WRITER,
+    RAW_WRITER
   };
 
   union Writer
@@ -737,6 +787,7 @@ private:
     ArrayWriter array_writer;
     ObjectWriter object_writer;
     NullWriter null_writer;
+    RawWriter raw_writer;
   };
 
   std::ostream* stream_;
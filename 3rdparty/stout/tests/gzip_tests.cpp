@@ -99,4 +99,79 @@ TEST(GzipTest, Decompressor)
 
   ASSERT_EQ(s, decompressed);
 }
+
+
+TEST(GzipTest, Compressor)
+{
+  string s =
+    "Lorem ipsum dolor sit amet, consectetur adipisicing elit, sed do "
+    "eiusmod tempor incididunt ut labore et dolore magna aliqua. Ut enim ad "
+    "minim veniam, quis nostrud exercitation ullamco laboris nisi ut "
+    "aliquip ex ea commodo consequat. Duis aute irure dolor in reprehenderit "
+    "in voluptate velit esse cillum dolore eu fugiat nulla pariatur. "
+    "Excepteur sint occaecat cupidatat non proident, sunt in culpa qui "
+    "officia deserunt mollit anim id est laborum.";
+
+  gzip::Compressor compressor;
+  gzip::Decompressor decompressor;
+
+  // Compress 16 bytes at a time, every compressed chunk should be
+  // enough to decompress all the input so far.
+  string decompressed;
+  size_t i = 0;
+
+  while (i < s.size()) {
+    const size_t chunkSize = 16;
+
+    Try<string> compressedChunk = compressor.compress(s.substr(i, chunkSize));
+    ASSERT_SOME(compressedChunk);
+
+    Try<string> decompressedChunk =
+      decompressor.decompress(compressedChunk.get());
+    ASSERT_SOME(decompressedChunk);
+    decompressed += decompressedChunk.get();
+
+    i += chunkSize;
+
+    ASSERT_EQ(s.substr(0, i), decompressed);
+  }
+
+  EXPECT_FALSE(compressor.finished());
+
+  Try<string> compressedChunk = compressor.finish();
+  ASSERT_SOME(compressedChunk);
+  EXPECT_TRUE(compressor.finished());
+
+  Try<string> decompressedChunk = decompressor.decompress(compressedChunk.get());
+  ASSERT_SOME(decompressedChunk);
+  EXPECT_EQ("", decompressedChunk.get());
+  EXPECT_TRUE(decompressor.finished());
+
+  // The stream cannot be used once it is finished.
+  EXPECT_ERROR(compressor.compress(s));
+
+  // The zlib format can be decompressed with zlib's `uncompress`.
+  gzip::Compressor zlib(Z_BEST_SPEED, gzip::Compressor::ZLIB);
+
+  Try<string> compressed = zlib.finish(s);
+  ASSERT_SOME(compressed);
+
+  Bytef buffer[1024];
+  uLongf length = sizeof(buffer);
+
+  ASSERT_EQ(Z_OK, uncompress(
+      buffer,
+      &length,
+      reinterpret_cast<const Bytef*>(compressed->data()),
+      compressed->size()));
+
+  EXPECT_EQ(s, string(reinterpret_cast<char*>(buffer), length));
+
+  EXPECT_SOME_EQ(
+      s,
+      gzip::decompress(compressed.get(), gzip::Decompressor::ZLIB));
+
+  // A gzip decompressor does not accept the zlib format.
+  EXPECT_ERROR(gzip::decompress(compressed.get()));
+}
 #endif // HAVE_LIBZ
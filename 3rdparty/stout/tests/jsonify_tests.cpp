@@ -338,3 +338,20 @@ TEST(JsonifyTest, JSONNull)
   JSON::Array numbers = JSON::Array{1, JSON::Null(), 3};
   EXPECT_EQ("[1,null,3]", string(jsonify(numbers)));
 }
+
+
+// Tests that already serialized JSON is written verbatim.
+TEST(JsonifyTest, Raw)
+{
+  const string name = "{\"first_name\":\"michael\",\"last_name\":\"park\"}";
+
+  auto raw = [&name](JSON::RawWriter* writer) { writer->set(name); };
+  EXPECT_EQ(name, string(jsonify(raw)));
+
+  auto names = [&name](JSON::ArrayWriter* writer) {
+    writer->element([&name](JSON::RawWriter* writer) { writer->set(name); });
+    writer->element([](JSON::RawWriter* writer) {});
+  };
+
+  EXPECT_EQ("[" + name + ",null]", string(jsonify(names)));
+}
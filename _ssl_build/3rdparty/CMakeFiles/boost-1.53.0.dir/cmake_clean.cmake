@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/boost-1.53.0"
+  "CMakeFiles/boost-1.53.0-complete"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-build"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-configure"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-download"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-install"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-mkdir"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-patch"
+  "boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/boost-1.53.0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
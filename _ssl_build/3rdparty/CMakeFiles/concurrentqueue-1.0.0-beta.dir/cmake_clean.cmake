@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/concurrentqueue-1.0.0-beta"
+  "CMakeFiles/concurrentqueue-1.0.0-beta-complete"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-build"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-configure"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-download"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-install"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-mkdir"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-patch"
+  "concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/concurrentqueue-1.0.0-beta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
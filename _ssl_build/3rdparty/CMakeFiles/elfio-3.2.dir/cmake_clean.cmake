@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/elfio-3.2"
+  "CMakeFiles/elfio-3.2-complete"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-build"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-configure"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-download"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-install"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-mkdir"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-patch"
+  "elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/elfio-3.2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
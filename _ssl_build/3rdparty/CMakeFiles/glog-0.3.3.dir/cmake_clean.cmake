@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/glog-0.3.3"
+  "CMakeFiles/glog-0.3.3-complete"
+  "glog-0.3.3/src/glog-0.3.3-build/lib/libglog.so"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-build"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-configure"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-download"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-install"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-mkdir"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-patch"
+  "glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/glog-0.3.3.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/googletest-1.8.0"
+  "CMakeFiles/googletest-1.8.0-complete"
+  "googletest-1.8.0/src/googletest-1.8.0-build/googlemock/gtest/libgtest.a"
+  "googletest-1.8.0/src/googletest-1.8.0-build/googlemock/libgmock.a"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-build"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-configure"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-download"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-install"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-mkdir"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-patch"
+  "googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/googletest-1.8.0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/http_parser-2.6.2"
+  "CMakeFiles/http_parser-2.6.2-complete"
+  "http_parser-2.6.2/src/http_parser-2.6.2-build/libhttp_parser.a"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-build"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-configure"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-download"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-install"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-mkdir"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-patch"
+  "http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/http_parser-2.6.2.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/leveldb-1.19"
+  "CMakeFiles/leveldb-1.19-complete"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-build"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-configure"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-download"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-install"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-mkdir"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-patch"
+  "leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-update"
+  "leveldb-1.19/src/leveldb-1.19/out-static/libleveldb.a"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/leveldb-1.19.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
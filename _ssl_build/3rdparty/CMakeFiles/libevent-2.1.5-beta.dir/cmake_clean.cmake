@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libevent-2.1.5-beta"
+  "CMakeFiles/libevent-2.1.5-beta-complete"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-build/lib/libevent.so"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-build"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-configure"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-download"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-install"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-mkdir"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-patch"
+  "libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/libevent-2.1.5-beta.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/nvml-352.79"
+  "CMakeFiles/nvml-352.79-complete"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-build"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-configure"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-download"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-install"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-mkdir"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-patch"
+  "nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/nvml-352.79.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,16 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/picojson-1.3.0"
+  "CMakeFiles/picojson-1.3.0-complete"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-build"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-configure"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-download"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-install"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-mkdir"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-patch"
+  "picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/picojson-1.3.0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
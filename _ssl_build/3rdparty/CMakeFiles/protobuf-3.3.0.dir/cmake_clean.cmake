@@ -0,0 +1,17 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/protobuf-3.3.0"
+  "CMakeFiles/protobuf-3.3.0-complete"
+  "protobuf-3.3.0/src/protobuf-3.3.0-build/libprotobuf.so"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-build"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-configure"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-download"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-install"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-mkdir"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-patch"
+  "protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/protobuf-3.3.0.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
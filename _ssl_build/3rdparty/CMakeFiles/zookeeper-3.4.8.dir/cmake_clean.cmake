@@ -0,0 +1,18 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/zookeeper-3.4.8"
+  "CMakeFiles/zookeeper-3.4.8-complete"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-build/libhashtable.a"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-build/libzookeeper.a"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-build"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-configure"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-download"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-install"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-mkdir"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-patch"
+  "zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-update"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang )
+  include(CMakeFiles/zookeeper-3.4.8.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty
+# Build directory: /root/repo/_ssl_build/3rdparty
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("stout")
+subdirs("libprocess")
@@ -0,0 +1,37 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+if("/root/repo/3rdparty/concurrentqueue-1.0.0-beta.tar.gz" STREQUAL "")
+  message(FATAL_ERROR "LOCAL can't be empty")
+endif()
+
+if(NOT EXISTS "/root/repo/3rdparty/concurrentqueue-1.0.0-beta.tar.gz")
+  message(FATAL_ERROR "File not found: /root/repo/3rdparty/concurrentqueue-1.0.0-beta.tar.gz")
+endif()
+
+if("SHA256" STREQUAL "")
+  message(WARNING "File will not be verified since no URL_HASH specified")
+  return()
+endif()
+
+if("d723e784e4d54f7519208bd795f2aa799a449b873dbb7a1251f288e04be23465" STREQUAL "")
+  message(FATAL_ERROR "EXPECT_VALUE can't be empty")
+endif()
+
+message(STATUS "verifying file...
+     file='/root/repo/3rdparty/concurrentqueue-1.0.0-beta.tar.gz'")
+
+file("SHA256" "/root/repo/3rdparty/concurrentqueue-1.0.0-beta.tar.gz" actual_value)
+
+if(NOT "${actual_value}" STREQUAL "d723e784e4d54f7519208bd795f2aa799a449b873dbb7a1251f288e04be23465")
+  message(FATAL_ERROR "error: SHA256 hash of
+  /root/repo/3rdparty/concurrentqueue-1.0.0-beta.tar.gz
+does not match expected value
+  expected: 'd723e784e4d54f7519208bd795f2aa799a449b873dbb7a1251f288e04be23465'
+    actual: '${actual_value}'
+")
+endif()
+
+message(STATUS "verifying file... done")
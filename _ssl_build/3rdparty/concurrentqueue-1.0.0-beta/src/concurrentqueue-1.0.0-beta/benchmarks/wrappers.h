@@ -0,0 +1,9 @@
+#pragma once
+
+struct DummyToken
+{
+	template<typename TQueue>
+	DummyToken(TQueue const&)
+	{
+	}
+};
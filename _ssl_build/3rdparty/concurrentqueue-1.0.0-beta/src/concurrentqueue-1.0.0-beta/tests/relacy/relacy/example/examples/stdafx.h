@@ -0,0 +1,16 @@
+#pragma once
+
+#ifdef NDEBUG
+#   define _SECURE_SCL 0
+#endif
+
+#define RL_FORCE_SEQ_CST
+#define RL_MSVC_OUTPUT
+//#define RL_DEBUGBREAK_ON_FAILURE
+
+#include "../../relacy/pch.hpp"
+#include "../../relacy/relacy_std.hpp"
+#include "../../relacy/stdlib/windows.hpp"
+
+
+
@@ -0,0 +1,7 @@
+#pragma once
+
+
+#include "../../relacy/pch.hpp"
+
+
+
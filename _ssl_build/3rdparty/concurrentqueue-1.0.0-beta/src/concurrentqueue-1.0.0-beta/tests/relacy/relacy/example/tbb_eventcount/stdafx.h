@@ -0,0 +1,6 @@
+#pragma once
+
+
+#include "../../relacy/pch.hpp"
+#include "../../relacy/relacy_std.hpp"
+
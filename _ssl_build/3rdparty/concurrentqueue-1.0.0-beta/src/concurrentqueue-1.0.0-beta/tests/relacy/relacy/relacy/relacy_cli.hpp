@@ -0,0 +1,29 @@
+/*  Relacy Race Detector
+ *  Copyright (c) 2008-2013, Dmitry S. Vyukov
+ *  All rights reserved.
+ *  This software is provided AS-IS with no warranty, either express or implied.
+ *  This software is distributed under a license and may not be copied,
+ *  modified or distributed except as expressly authorized under the
+ *  terms of the license contained in the file LICENSE in this distribution.
+ */
+
+#ifndef RL_RELACY_CLI_HPP
+#define RL_RELACY_CLI_HPP
+#ifdef _MSC_VER
+#   pragma once
+#endif
+
+
+#define RL_CLI_MODE
+
+#include "relacy.hpp"
+
+#include "cli.hpp"
+#include "cli_interlocked.hpp"
+#include "cli_volatile.hpp"
+#include "cli_var.hpp"
+
+
+
+
+#endif
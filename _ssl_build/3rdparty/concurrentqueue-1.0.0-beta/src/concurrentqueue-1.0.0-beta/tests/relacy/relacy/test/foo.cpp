@@ -0,0 +1,6 @@
+#include "stdafx.h"
+#include "../relacy/relacy_std.hpp"
+#include "../relacy/windows.h"
+#include "../relacy/pthread.h"
+
+
@@ -0,0 +1,4 @@
+#!/bin/bash
+g++ ../main.cpp -o test_release.exe -DNDEBUG -DRL_CYGWIN_STUB -Wall -O3
+
+
@@ -0,0 +1,4 @@
+#!/bin/bash
+g++ ../main.cpp -o test_release.exe -DNDEBUG -Wall -O3 -D_XOPEN_SOURCE -Wno-deprecated
+
+
@@ -0,0 +1,7 @@
+#pragma once
+
+//#define RL_JAVA_MODE
+//#define RL_MSVC_OUTPUT
+
+#include "../relacy/pch.hpp"
+
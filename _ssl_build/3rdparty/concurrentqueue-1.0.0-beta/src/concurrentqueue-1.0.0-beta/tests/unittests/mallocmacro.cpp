@@ -0,0 +1,4 @@
+#define malloc(x) malloc(x)
+#define free(x) free(x)
+
+#include "../../blockingconcurrentqueue.h"
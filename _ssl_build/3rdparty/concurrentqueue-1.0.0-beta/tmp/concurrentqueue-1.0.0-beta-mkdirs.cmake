@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta"
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-build"
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta"
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/tmp"
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp"
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src"
+  "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_ssl_build/3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,8 @@
+#include <stdio.h>
+
+int main()
+{
+    printf( "Hello\n" );
+
+    return 0;
+}
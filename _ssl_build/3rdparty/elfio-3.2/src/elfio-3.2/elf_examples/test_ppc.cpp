@@ -0,0 +1,8 @@
+#include <iostream>
+
+int main()
+{
+  std::cout << "Hello" << std::endl;
+  
+  return 0;
+}
@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/_gate_build/3rdparty/googletest-1.8.0/src/googletest-1.8.0/googletest/src/gtest-all.cc" "googlemock/CMakeFiles/gmock_main.dir/__/googletest/src/gtest-all.cc.o" "gcc" "googlemock/CMakeFiles/gmock_main.dir/__/googletest/src/gtest-all.cc.o.d"
+  "/root/repo/_gate_build/3rdparty/googletest-1.8.0/src/googletest-1.8.0/googlemock/src/gmock-all.cc" "googlemock/CMakeFiles/gmock_main.dir/src/gmock-all.cc.o" "gcc" "googlemock/CMakeFiles/gmock_main.dir/src/gmock-all.cc.o.d"
+  "/root/repo/_gate_build/3rdparty/googletest-1.8.0/src/googletest-1.8.0/googlemock/src/gmock_main.cc" "googlemock/CMakeFiles/gmock_main.dir/src/gmock_main.cc.o" "gcc" "googlemock/CMakeFiles/gmock_main.dir/src/gmock_main.cc.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/_gate_build/3rdparty/googletest-1.8.0/src/googletest-1.8.0/googletest
+# Build directory: /root/repo/_gate_build/3rdparty/googletest-1.8.0/src/googletest-1.8.0-build/googlemock/gtest
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src/http_parser-2.6.2"
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-build"
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2"
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/tmp"
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp"
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src"
+  "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_ssl_build/3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp${cfgdir}") # cfgdir has leading slash
+endif()
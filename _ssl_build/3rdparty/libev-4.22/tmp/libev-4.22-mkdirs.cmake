@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_gate_build/3rdparty/libev-4.22/src/libev-4.22"
+  "/root/repo/_gate_build/3rdparty/libev-4.22/src/libev-4.22-build"
+  "/root/repo/_gate_build/3rdparty/libev-4.22"
+  "/root/repo/_gate_build/3rdparty/libev-4.22/tmp"
+  "/root/repo/_gate_build/3rdparty/libev-4.22/src/libev-4.22-stamp"
+  "/root/repo/_gate_build/3rdparty/libev-4.22/src"
+  "/root/repo/_gate_build/3rdparty/libev-4.22/src/libev-4.22-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_gate_build/3rdparty/libev-4.22/src/libev-4.22-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_gate_build/3rdparty/libev-4.22/src/libev-4.22-stamp${cfgdir}") # cfgdir has leading slash
+endif()
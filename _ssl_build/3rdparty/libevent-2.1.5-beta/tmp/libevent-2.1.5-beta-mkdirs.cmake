@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta"
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-build"
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta"
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/tmp"
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp"
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src"
+  "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/_ssl_build/3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,47 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/libprocess/src/authenticator.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/authenticator.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/authenticator.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/authenticator_manager.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/authenticator_manager.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/authenticator_manager.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/clock.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/clock.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/clock.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/firewall.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/firewall.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/firewall.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/help.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/help.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/help.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/histogram.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/histogram.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/histogram.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/http.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/http.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/http.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/io.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/io.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/io.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/jwt.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/jwt.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/jwt.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/jwt_authenticator.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/jwt_authenticator.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/jwt_authenticator.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/latch.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/latch.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/latch.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/libevent.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/libevent.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/libevent.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/libevent_poll.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/libevent_poll.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/libevent_poll.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/libevent_ssl_socket.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/libevent_ssl_socket.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/libevent_ssl_socket.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/logging.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/logging.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/logging.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/metrics/metrics.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/metrics/metrics.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/metrics/metrics.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/mime.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/mime.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/mime.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/openssl.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/openssl.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/openssl.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/pid.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/pid.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/pid.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/poll_socket.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/poll_socket.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/poll_socket.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/process.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/process.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/process.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/profiler.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/profiler.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/profiler.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/reap.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/reap.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/reap.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/socket.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/socket.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/socket.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/ssl/utilities.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/ssl/utilities.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/ssl/utilities.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/subprocess.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/subprocess.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/subprocess.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/subprocess_posix.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/subprocess_posix.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/subprocess_posix.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/time.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/time.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/time.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/timeseries.cpp" "3rdparty/libprocess/src/CMakeFiles/process.dir/timeseries.cpp.o" "gcc" "3rdparty/libprocess/src/CMakeFiles/process.dir/timeseries.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
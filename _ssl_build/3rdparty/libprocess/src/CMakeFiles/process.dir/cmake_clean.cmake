@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/process.dir/authenticator.cpp.o"
+  "CMakeFiles/process.dir/authenticator.cpp.o.d"
+  "CMakeFiles/process.dir/authenticator_manager.cpp.o"
+  "CMakeFiles/process.dir/authenticator_manager.cpp.o.d"
+  "CMakeFiles/process.dir/clock.cpp.o"
+  "CMakeFiles/process.dir/clock.cpp.o.d"
+  "CMakeFiles/process.dir/firewall.cpp.o"
+  "CMakeFiles/process.dir/firewall.cpp.o.d"
+  "CMakeFiles/process.dir/help.cpp.o"
+  "CMakeFiles/process.dir/help.cpp.o.d"
+  "CMakeFiles/process.dir/histogram.cpp.o"
+  "CMakeFiles/process.dir/histogram.cpp.o.d"
+  "CMakeFiles/process.dir/http.cpp.o"
+  "CMakeFiles/process.dir/http.cpp.o.d"
+  "CMakeFiles/process.dir/io.cpp.o"
+  "CMakeFiles/process.dir/io.cpp.o.d"
+  "CMakeFiles/process.dir/jwt.cpp.o"
+  "CMakeFiles/process.dir/jwt.cpp.o.d"
+  "CMakeFiles/process.dir/jwt_authenticator.cpp.o"
+  "CMakeFiles/process.dir/jwt_authenticator.cpp.o.d"
+  "CMakeFiles/process.dir/latch.cpp.o"
+  "CMakeFiles/process.dir/latch.cpp.o.d"
+  "CMakeFiles/process.dir/libevent.cpp.o"
+  "CMakeFiles/process.dir/libevent.cpp.o.d"
+  "CMakeFiles/process.dir/libevent_poll.cpp.o"
+  "CMakeFiles/process.dir/libevent_poll.cpp.o.d"
+  "CMakeFiles/process.dir/libevent_ssl_socket.cpp.o"
+  "CMakeFiles/process.dir/libevent_ssl_socket.cpp.o.d"
+  "CMakeFiles/process.dir/logging.cpp.o"
+  "CMakeFiles/process.dir/logging.cpp.o.d"
+  "CMakeFiles/process.dir/metrics/metrics.cpp.o"
+  "CMakeFiles/process.dir/metrics/metrics.cpp.o.d"
+  "CMakeFiles/process.dir/mime.cpp.o"
+  "CMakeFiles/process.dir/mime.cpp.o.d"
+  "CMakeFiles/process.dir/openssl.cpp.o"
+  "CMakeFiles/process.dir/openssl.cpp.o.d"
+  "CMakeFiles/process.dir/pid.cpp.o"
+  "CMakeFiles/process.dir/pid.cpp.o.d"
+  "CMakeFiles/process.dir/poll_socket.cpp.o"
+  "CMakeFiles/process.dir/poll_socket.cpp.o.d"
+  "CMakeFiles/process.dir/process.cpp.o"
+  "CMakeFiles/process.dir/process.cpp.o.d"
+  "CMakeFiles/process.dir/profiler.cpp.o"
+  "CMakeFiles/process.dir/profiler.cpp.o.d"
+  "CMakeFiles/process.dir/reap.cpp.o"
+  "CMakeFiles/process.dir/reap.cpp.o.d"
+  "CMakeFiles/process.dir/socket.cpp.o"
+  "CMakeFiles/process.dir/socket.cpp.o.d"
+  "CMakeFiles/process.dir/ssl/utilities.cpp.o"
+  "CMakeFiles/process.dir/ssl/utilities.cpp.o.d"
+  "CMakeFiles/process.dir/subprocess.cpp.o"
+  "CMakeFiles/process.dir/subprocess.cpp.o.d"
+  "CMakeFiles/process.dir/subprocess_posix.cpp.o"
+  "CMakeFiles/process.dir/subprocess_posix.cpp.o.d"
+  "CMakeFiles/process.dir/time.cpp.o"
+  "CMakeFiles/process.dir/time.cpp.o.d"
+  "CMakeFiles/process.dir/timeseries.cpp.o"
+  "CMakeFiles/process.dir/timeseries.cpp.o.d"
+  "libprocess.pdb"
+  "libprocess.so"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/process.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
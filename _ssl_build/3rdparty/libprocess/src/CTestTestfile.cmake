@@ -0,0 +1,6 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty/libprocess/src
+# Build directory: /root/repo/_ssl_build/3rdparty/libprocess/src
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
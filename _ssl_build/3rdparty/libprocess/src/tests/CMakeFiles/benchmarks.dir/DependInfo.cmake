@@ -0,0 +1,27 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/libprocess/src/tests/benchmarks.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/benchmarks.dir/benchmarks.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/benchmarks.dir/benchmarks.cpp.o.d"
+  "/root/repo/_ssl_build/3rdparty/libprocess/src/tests/benchmarks.pb.cc" "3rdparty/libprocess/src/tests/CMakeFiles/benchmarks.dir/benchmarks.pb.cc.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/benchmarks.dir/benchmarks.pb.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ssl_build/3rdparty/libprocess/src/tests/benchmarks.pb.h" "/root/repo/_ssl_build/3rdparty/libprocess/src/tests/benchmarks.pb.cc"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ssl_build/3rdparty/libprocess/src/CMakeFiles/process.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,15 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/benchmarks.dir/benchmarks.cpp.o"
+  "CMakeFiles/benchmarks.dir/benchmarks.cpp.o.d"
+  "CMakeFiles/benchmarks.dir/benchmarks.pb.cc.o"
+  "CMakeFiles/benchmarks.dir/benchmarks.pb.cc.o.d"
+  "benchmarks"
+  "benchmarks.pb.cc"
+  "benchmarks.pb.h"
+  "benchmarks.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/benchmarks.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
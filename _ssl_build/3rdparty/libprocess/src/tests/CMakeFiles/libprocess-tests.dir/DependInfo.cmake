@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/libprocess/src/tests/after_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/after_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/after_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/collect_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/collect_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/collect_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/count_down_latch_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/count_down_latch_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/count_down_latch_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/decoder_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/decoder_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/decoder_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/encoder_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/encoder_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/encoder_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/future_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/future_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/future_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/histogram_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/histogram_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/histogram_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/http_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/http_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/http_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/io_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/io_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/io_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/jwt_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/jwt_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/jwt_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/limiter_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/limiter_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/limiter_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/loop_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/loop_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/loop_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/main.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/main.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/main.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/metrics_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/metrics_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/metrics_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/mutex_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/mutex_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/mutex_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/owned_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/owned_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/owned_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/process_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/process_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/process_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/queue_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/queue_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/queue_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/reap_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/reap_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/reap_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/rwlock_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/rwlock_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/rwlock_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/sequence_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/sequence_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/sequence_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/shared_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/shared_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/shared_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/socket_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/socket_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/socket_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/ssl_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/ssl_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/ssl_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/statistics_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/statistics_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/statistics_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/subprocess_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/subprocess_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/subprocess_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/system_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/system_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/system_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/time_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/time_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/time_tests.cpp.o.d"
+  "/root/repo/3rdparty/libprocess/src/tests/timeseries_tests.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/timeseries_tests.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/timeseries_tests.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ssl_build/3rdparty/libprocess/src/CMakeFiles/process.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
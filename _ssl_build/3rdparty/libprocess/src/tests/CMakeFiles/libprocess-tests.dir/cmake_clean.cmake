@@ -0,0 +1,67 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/libprocess-tests.dir/after_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/after_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/collect_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/collect_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/count_down_latch_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/count_down_latch_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/decoder_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/decoder_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/encoder_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/encoder_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/future_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/future_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/histogram_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/histogram_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/http_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/http_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/io_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/io_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/jwt_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/jwt_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/limiter_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/limiter_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/loop_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/loop_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/main.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/main.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/metrics_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/metrics_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/mutex_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/mutex_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/owned_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/owned_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/process_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/process_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/queue_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/queue_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/reap_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/reap_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/rwlock_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/rwlock_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/sequence_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/sequence_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/shared_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/shared_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/socket_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/socket_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/ssl_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/ssl_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/statistics_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/statistics_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/subprocess_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/subprocess_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/system_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/system_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/time_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/time_tests.cpp.o.d"
+  "CMakeFiles/libprocess-tests.dir/timeseries_tests.cpp.o"
+  "CMakeFiles/libprocess-tests.dir/timeseries_tests.cpp.o.d"
+  "libprocess-tests"
+  "libprocess-tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/libprocess-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
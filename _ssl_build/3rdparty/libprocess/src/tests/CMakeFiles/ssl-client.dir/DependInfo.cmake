@@ -0,0 +1,20 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/libprocess/src/tests/ssl_client.cpp" "3rdparty/libprocess/src/tests/CMakeFiles/ssl-client.dir/ssl_client.cpp.o" "gcc" "3rdparty/libprocess/src/tests/CMakeFiles/ssl-client.dir/ssl_client.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  "/root/repo/_ssl_build/3rdparty/libprocess/src/CMakeFiles/process.dir/DependInfo.cmake"
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/ssl-client.dir/ssl_client.cpp.o"
+  "CMakeFiles/ssl-client.dir/ssl_client.cpp.o.d"
+  "ssl-client"
+  "ssl-client.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/ssl-client.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
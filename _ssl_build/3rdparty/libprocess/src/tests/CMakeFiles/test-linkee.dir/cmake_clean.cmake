@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/test-linkee.dir/test_linkee.cpp.o"
+  "CMakeFiles/test-linkee.dir/test_linkee.cpp.o.d"
+  "test-linkee"
+  "test-linkee.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/test-linkee.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty/libprocess/src/tests
+# Build directory: /root/repo/_ssl_build/3rdparty/libprocess/src/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(ProcessTests "/root/repo/_ssl_build/3rdparty/libprocess/src/tests/libprocess-tests")
+set_tests_properties(ProcessTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/3rdparty/libprocess/src/tests/CMakeLists.txt;99;add_test;/root/repo/3rdparty/libprocess/src/tests/CMakeLists.txt;0;")
@@ -0,0 +1,7 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty/stout
+# Build directory: /root/repo/_ssl_build/3rdparty/stout
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+subdirs("tests")
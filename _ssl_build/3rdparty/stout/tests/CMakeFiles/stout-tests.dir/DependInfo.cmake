@@ -0,0 +1,71 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/3rdparty/stout/tests/base64_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/base64_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/base64_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/bits_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/bits_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/bits_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/bytes_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/bytes_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/bytes_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/cache_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/cache_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/cache_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/duration_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/duration_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/duration_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/dynamiclibrary_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/dynamiclibrary_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/dynamiclibrary_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/error_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/error_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/error_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/flags_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/flags_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/flags_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/gzip_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/gzip_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/gzip_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/hashmap_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/hashmap_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/hashmap_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/hashset_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/hashset_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/hashset_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/interval_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/interval_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/interval_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/ip_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/ip_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/ip_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/json_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/json_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/json_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/jsonify_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/jsonify_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/jsonify_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/lambda_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/lambda_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/lambda_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/linkedhashmap_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/linkedhashmap_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/linkedhashmap_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/mac_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/mac_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/mac_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/main.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/main.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/main.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/multimap_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/multimap_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/multimap_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/none_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/none_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/none_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/numify_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/numify_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/numify_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/option_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/option_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/option_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/env_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/env_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/env_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/filesystem_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/filesystem_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/filesystem_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/process_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/process_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/process_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/rmdir_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/rmdir_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/rmdir_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/sendfile_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/sendfile_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/sendfile_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/signals_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/signals_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/signals_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/socket_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/socket_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/socket_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/strerror_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/strerror_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/strerror_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os/systems_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/systems_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os/systems_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/os_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/os_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/path_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/path_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/path_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/proc_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/proc_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/proc_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/protobuf_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/protobuf_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/protobuf_tests.cpp.o.d"
+  "/root/repo/_ssl_build/3rdparty/stout/tests/protobuf_tests.pb.cc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/protobuf_tests.pb.cc.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/protobuf_tests.pb.cc.o.d"
+  "/root/repo/3rdparty/stout/tests/recordio_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/recordio_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/recordio_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/result_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/result_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/result_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/some_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/some_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/some_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/strings_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/strings_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/strings_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/subcommand_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/subcommand_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/subcommand_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/svn_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/svn_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/svn_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/try_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/try_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/try_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/uuid_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/uuid_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/uuid_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/variant_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/variant_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/variant_tests.cpp.o.d"
+  "/root/repo/3rdparty/stout/tests/version_tests.cpp" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/version_tests.cpp.o" "gcc" "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/version_tests.cpp.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_ssl_build/3rdparty/stout/tests/protobuf_tests.pb.cc" "/root/repo/_ssl_build/3rdparty/stout/tests/protobuf_tests.pb.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
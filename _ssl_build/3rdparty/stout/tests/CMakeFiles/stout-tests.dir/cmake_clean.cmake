@@ -0,0 +1,105 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stout-tests.dir/base64_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/base64_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/bits_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/bits_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/bytes_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/bytes_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/cache_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/cache_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/duration_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/duration_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/dynamiclibrary_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/dynamiclibrary_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/error_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/error_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/flags_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/flags_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/gzip_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/gzip_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/hashmap_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/hashmap_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/hashset_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/hashset_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/interval_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/interval_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/ip_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/ip_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/json_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/json_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/jsonify_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/jsonify_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/lambda_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/lambda_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/linkedhashmap_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/linkedhashmap_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/mac_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/mac_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/main.cpp.o"
+  "CMakeFiles/stout-tests.dir/main.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/multimap_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/multimap_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/none_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/none_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/numify_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/numify_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/option_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/option_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/env_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/env_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/filesystem_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/filesystem_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/process_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/process_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/rmdir_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/rmdir_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/sendfile_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/sendfile_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/signals_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/signals_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/socket_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/socket_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/strerror_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/strerror_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os/systems_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os/systems_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/os_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/os_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/path_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/path_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/proc_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/proc_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/protobuf_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/protobuf_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/protobuf_tests.pb.cc.o"
+  "CMakeFiles/stout-tests.dir/protobuf_tests.pb.cc.o.d"
+  "CMakeFiles/stout-tests.dir/recordio_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/recordio_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/result_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/result_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/some_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/some_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/strings_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/strings_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/subcommand_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/subcommand_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/svn_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/svn_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/try_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/try_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/uuid_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/uuid_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/variant_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/variant_tests.cpp.o.d"
+  "CMakeFiles/stout-tests.dir/version_tests.cpp.o"
+  "CMakeFiles/stout-tests.dir/version_tests.cpp.o.d"
+  "protobuf_tests.pb.cc"
+  "protobuf_tests.pb.h"
+  "stout-tests"
+  "stout-tests.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stout-tests.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
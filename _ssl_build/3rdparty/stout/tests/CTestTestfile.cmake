@@ -0,0 +1,8 @@
+# CMake generated Testfile for 
+# Source directory: /root/repo/3rdparty/stout/tests
+# Build directory: /root/repo/_ssl_build/3rdparty/stout/tests
+# 
+# This file includes the relevant testing commands required for 
+# testing this directory and lists subdirectories to be tested as well.
+add_test(StoutTests "/root/repo/_ssl_build/3rdparty/stout/tests/stout-tests")
+set_tests_properties(StoutTests PROPERTIES  _BACKTRACE_TRIPLES "/root/repo/3rdparty/stout/tests/CMakeLists.txt;105;add_test;/root/repo/3rdparty/stout/tests/CMakeLists.txt;0;")
@@ -0,0 +1,301 @@
+# CMAKE generated file: DO NOT EDIT!
+# Generated by "Unix Makefiles" Generator, CMake Version 3.25
+
+# The generator used is:
+set(CMAKE_DEPENDS_GENERATOR "Unix Makefiles")
+
+# The top level Makefile was generated from the following files:
+set(CMAKE_MAKEFILE_DEPENDS
+  "CMakeCache.txt"
+  "/root/repo/3rdparty/CMakeLists.txt"
+  "/root/repo/3rdparty/cmake/External.cmake"
+  "/root/repo/3rdparty/cmake/PatchCommand.cmake"
+  "/root/repo/3rdparty/cmake/Versions.cmake"
+  "/root/repo/3rdparty/cmake/cotire.cmake"
+  "/root/repo/3rdparty/libprocess/CMakeLists.txt"
+  "/root/repo/3rdparty/libprocess/src/CMakeLists.txt"
+  "/root/repo/3rdparty/libprocess/src/tests/CMakeLists.txt"
+  "/root/repo/3rdparty/stout/CMakeLists.txt"
+  "/root/repo/3rdparty/stout/cmake/FindApr.cmake"
+  "/root/repo/3rdparty/stout/cmake/FindPackageHelper.cmake"
+  "/root/repo/3rdparty/stout/cmake/FindSvn.cmake"
+  "/root/repo/3rdparty/stout/tests/CMakeLists.txt"
+  "/root/repo/CMakeLists.txt"
+  "3rdparty/boost-1.53.0/tmp/boost-1.53.0-mkdirs.cmake"
+  "3rdparty/concurrentqueue-1.0.0-beta/tmp/concurrentqueue-1.0.0-beta-mkdirs.cmake"
+  "3rdparty/elfio-3.2/tmp/elfio-3.2-mkdirs.cmake"
+  "3rdparty/glog-0.3.3/tmp/glog-0.3.3-mkdirs.cmake"
+  "3rdparty/googletest-1.8.0/tmp/googletest-1.8.0-mkdirs.cmake"
+  "3rdparty/http_parser-2.6.2/tmp/http_parser-2.6.2-mkdirs.cmake"
+  "3rdparty/leveldb-1.19/tmp/leveldb-1.19-mkdirs.cmake"
+  "3rdparty/libevent-2.1.5-beta/tmp/libevent-2.1.5-beta-mkdirs.cmake"
+  "3rdparty/nvml-352.79/tmp/nvml-352.79-mkdirs.cmake"
+  "3rdparty/picojson-1.3.0/tmp/picojson-1.3.0-mkdirs.cmake"
+  "3rdparty/protobuf-3.3.0/tmp/protobuf-3.3.0-mkdirs.cmake"
+  "3rdparty/zookeeper-3.4.8/tmp/zookeeper-3.4.8-mkdirs.cmake"
+  "CMakeFiles/3.25.1/CMakeCCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeCXXCompiler.cmake"
+  "CMakeFiles/3.25.1/CMakeSystem.cmake"
+  "/root/repo/bin/gdb-mesos-agent.sh.in"
+  "/root/repo/bin/gdb-mesos-local.sh.in"
+  "/root/repo/bin/gdb-mesos-master.sh.in"
+  "/root/repo/bin/gdb-mesos-tests.sh.in"
+  "/root/repo/bin/lldb-mesos-agent.sh.in"
+  "/root/repo/bin/lldb-mesos-local.sh.in"
+  "/root/repo/bin/lldb-mesos-master.sh.in"
+  "/root/repo/bin/lldb-mesos-tests.sh.in"
+  "/root/repo/bin/mesos-agent-flags.sh.in"
+  "/root/repo/bin/mesos-agent.sh.in"
+  "/root/repo/bin/mesos-local-flags.sh.in"
+  "/root/repo/bin/mesos-local.sh.in"
+  "/root/repo/bin/mesos-master-flags.sh.in"
+  "/root/repo/bin/mesos-master.sh.in"
+  "/root/repo/bin/mesos-tests-flags.sh.in"
+  "/root/repo/bin/mesos-tests.sh.in"
+  "/root/repo/bin/mesos.sh.in"
+  "/root/repo/bin/valgrind-mesos-agent.sh.in"
+  "/root/repo/bin/valgrind-mesos-local.sh.in"
+  "/root/repo/bin/valgrind-mesos-master.sh.in"
+  "/root/repo/bin/valgrind-mesos-tests.sh.in"
+  "/root/repo/cmake/CompilationConfigure.cmake"
+  "/root/repo/cmake/MesosConfigure.cmake"
+  "/root/repo/include/mesos/version.hpp.in"
+  "/root/repo/src/CMakeLists.txt"
+  "/root/repo/src/checks/CMakeLists.txt"
+  "/root/repo/src/cli/CMakeLists.txt"
+  "/root/repo/src/cmake/MesosProtobuf.cmake"
+  "/root/repo/src/common/build_config.hpp.in"
+  "/root/repo/src/docker/CMakeLists.txt"
+  "/root/repo/src/examples/CMakeLists.txt"
+  "/root/repo/src/launcher/CMakeLists.txt"
+  "/root/repo/src/local/CMakeLists.txt"
+  "/root/repo/src/log/CMakeLists.txt"
+  "/root/repo/src/master/CMakeLists.txt"
+  "/root/repo/src/slave/CMakeLists.txt"
+  "/root/repo/src/slave/container_loggers/CMakeLists.txt"
+  "/root/repo/src/slave/containerizer/mesos/CMakeLists.txt"
+  "/root/repo/src/slave/qos_controllers/CMakeLists.txt"
+  "/root/repo/src/slave/resource_estimators/CMakeLists.txt"
+  "/root/repo/src/tests/CMakeLists.txt"
+  "/root/repo/src/usage/CMakeLists.txt"
+  "/usr/share/cmake-3.25/Modules/CMakeCInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCXXInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCheckCompilerFlagCommonPatterns.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeCommonLanguageInclude.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeGenericSystem.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeInitializeConfigs.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeLanguageInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeParseArguments.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInformation.cmake"
+  "/usr/share/cmake-3.25/Modules/CMakeSystemSpecificInitialize.cmake"
+  "/usr/share/cmake-3.25/Modules/CPack.cmake"
+  "/usr/share/cmake-3.25/Modules/CPackComponent.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckCXXSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckIncludeFile.cmake"
+  "/usr/share/cmake-3.25/Modules/CheckLibraryExists.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/CMakeCommonCompilerMacros.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Compiler/GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject.cmake"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/RepositoryInfo.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/cfgcmd.txt.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/download.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/extractfile.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/mkdirs.cmake.in"
+  "/usr/share/cmake-3.25/Modules/ExternalProject/verify.cmake.in"
+  "/usr/share/cmake-3.25/Modules/FindCURL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindOpenSSL.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageHandleStandardArgs.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPackageMessage.cmake"
+  "/usr/share/cmake-3.25/Modules/FindPkgConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/FindThreads.cmake"
+  "/usr/share/cmake-3.25/Modules/FindZLIB.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckCompilerFlag.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckFlagCommonConfig.cmake"
+  "/usr/share/cmake-3.25/Modules/Internal/CheckSourceCompiles.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-C.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU-CXX.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux-GNU.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/Linux.cmake"
+  "/usr/share/cmake-3.25/Modules/Platform/UnixPaths.cmake"
+  "/usr/share/cmake-3.25/Modules/ProcessorCount.cmake"
+  "/usr/share/cmake-3.25/Modules/SelectLibraryConfigurations.cmake"
+  "/usr/share/cmake-3.25/Templates/CPackConfig.cmake.in"
+  )
+
+# The corresponding makefile is:
+set(CMAKE_MAKEFILE_OUTPUTS
+  "Makefile"
+  "CMakeFiles/cmake.check_cache"
+  )
+
+# Byproducts of CMake generate step:
+set(CMAKE_MAKEFILE_PRODUCTS
+  "src/common/build_config.hpp"
+  "CPackConfig.cmake"
+  "CPackSourceConfig.cmake"
+  "CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/boost-1.53.0/tmp/boost-1.53.0-mkdirs.cmake"
+  "3rdparty/boost-1.53.0/src/boost-1.53.0-stamp/verify-boost-1.53.0.cmake"
+  "3rdparty/boost-1.53.0/src/boost-1.53.0-stamp/extract-boost-1.53.0.cmake"
+  "3rdparty/boost-1.53.0/src/boost-1.53.0-stamp/boost-1.53.0-urlinfo.txt"
+  "3rdparty/boost-1.53.0/tmp/boost-1.53.0-cfgcmd.txt"
+  "3rdparty/concurrentqueue-1.0.0-beta/tmp/concurrentqueue-1.0.0-beta-mkdirs.cmake"
+  "3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/verify-concurrentqueue-1.0.0-beta.cmake"
+  "3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/extract-concurrentqueue-1.0.0-beta.cmake"
+  "3rdparty/concurrentqueue-1.0.0-beta/src/concurrentqueue-1.0.0-beta-stamp/concurrentqueue-1.0.0-beta-urlinfo.txt"
+  "3rdparty/concurrentqueue-1.0.0-beta/tmp/concurrentqueue-1.0.0-beta-cfgcmd.txt"
+  "3rdparty/elfio-3.2/tmp/elfio-3.2-mkdirs.cmake"
+  "3rdparty/elfio-3.2/src/elfio-3.2-stamp/verify-elfio-3.2.cmake"
+  "3rdparty/elfio-3.2/src/elfio-3.2-stamp/extract-elfio-3.2.cmake"
+  "3rdparty/elfio-3.2/src/elfio-3.2-stamp/elfio-3.2-urlinfo.txt"
+  "3rdparty/elfio-3.2/tmp/elfio-3.2-cfgcmd.txt"
+  "3rdparty/glog-0.3.3/tmp/glog-0.3.3-mkdirs.cmake"
+  "3rdparty/glog-0.3.3/src/glog-0.3.3-stamp/verify-glog-0.3.3.cmake"
+  "3rdparty/glog-0.3.3/src/glog-0.3.3-stamp/extract-glog-0.3.3.cmake"
+  "3rdparty/glog-0.3.3/src/glog-0.3.3-stamp/glog-0.3.3-urlinfo.txt"
+  "3rdparty/glog-0.3.3/tmp/glog-0.3.3-cfgcmd.txt"
+  "3rdparty/picojson-1.3.0/tmp/picojson-1.3.0-mkdirs.cmake"
+  "3rdparty/picojson-1.3.0/src/picojson-1.3.0-stamp/verify-picojson-1.3.0.cmake"
+  "3rdparty/picojson-1.3.0/src/picojson-1.3.0-stamp/extract-picojson-1.3.0.cmake"
+  "3rdparty/picojson-1.3.0/src/picojson-1.3.0-stamp/picojson-1.3.0-urlinfo.txt"
+  "3rdparty/picojson-1.3.0/tmp/picojson-1.3.0-cfgcmd.txt"
+  "3rdparty/nvml-352.79/tmp/nvml-352.79-mkdirs.cmake"
+  "3rdparty/nvml-352.79/src/nvml-352.79-stamp/verify-nvml-352.79.cmake"
+  "3rdparty/nvml-352.79/src/nvml-352.79-stamp/extract-nvml-352.79.cmake"
+  "3rdparty/nvml-352.79/src/nvml-352.79-stamp/nvml-352.79-urlinfo.txt"
+  "3rdparty/nvml-352.79/tmp/nvml-352.79-cfgcmd.txt"
+  "3rdparty/http_parser-2.6.2/tmp/http_parser-2.6.2-mkdirs.cmake"
+  "3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp/verify-http_parser-2.6.2.cmake"
+  "3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp/extract-http_parser-2.6.2.cmake"
+  "3rdparty/http_parser-2.6.2/src/http_parser-2.6.2-stamp/http_parser-2.6.2-urlinfo.txt"
+  "3rdparty/http_parser-2.6.2/tmp/http_parser-2.6.2-cfgcmd.txt"
+  "3rdparty/libevent-2.1.5-beta/tmp/libevent-2.1.5-beta-mkdirs.cmake"
+  "3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/download-libevent-2.1.5-beta.cmake"
+  "3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/extract-libevent-2.1.5-beta.cmake"
+  "3rdparty/libevent-2.1.5-beta/src/libevent-2.1.5-beta-stamp/libevent-2.1.5-beta-urlinfo.txt"
+  "3rdparty/libevent-2.1.5-beta/tmp/libevent-2.1.5-beta-cfgcmd.txt"
+  "3rdparty/googletest-1.8.0/tmp/googletest-1.8.0-mkdirs.cmake"
+  "3rdparty/googletest-1.8.0/src/googletest-1.8.0-stamp/verify-googletest-1.8.0.cmake"
+  "3rdparty/googletest-1.8.0/src/googletest-1.8.0-stamp/extract-googletest-1.8.0.cmake"
+  "3rdparty/googletest-1.8.0/src/googletest-1.8.0-stamp/googletest-1.8.0-urlinfo.txt"
+  "3rdparty/googletest-1.8.0/tmp/googletest-1.8.0-cfgcmd.txt"
+  "3rdparty/protobuf-3.3.0/tmp/protobuf-3.3.0-mkdirs.cmake"
+  "3rdparty/protobuf-3.3.0/src/protobuf-3.3.0-stamp/verify-protobuf-3.3.0.cmake"
+  "3rdparty/protobuf-3.3.0/src/protobuf-3.3.0-stamp/extract-protobuf-3.3.0.cmake"
+  "3rdparty/protobuf-3.3.0/src/protobuf-3.3.0-stamp/protobuf-3.3.0-urlinfo.txt"
+  "3rdparty/protobuf-3.3.0/tmp/protobuf-3.3.0-cfgcmd.txt"
+  "3rdparty/zookeeper-3.4.8/tmp/zookeeper-3.4.8-mkdirs.cmake"
+  "3rdparty/zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/verify-zookeeper-3.4.8.cmake"
+  "3rdparty/zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/extract-zookeeper-3.4.8.cmake"
+  "3rdparty/zookeeper-3.4.8/src/zookeeper-3.4.8-stamp/zookeeper-3.4.8-urlinfo.txt"
+  "3rdparty/zookeeper-3.4.8/tmp/zookeeper-3.4.8-cfgcmd.txt"
+  "3rdparty/leveldb-1.19/tmp/leveldb-1.19-mkdirs.cmake"
+  "3rdparty/leveldb-1.19/src/leveldb-1.19-stamp/verify-leveldb-1.19.cmake"
+  "3rdparty/leveldb-1.19/src/leveldb-1.19-stamp/extract-leveldb-1.19.cmake"
+  "3rdparty/leveldb-1.19/src/leveldb-1.19-stamp/leveldb-1.19-urlinfo.txt"
+  "3rdparty/leveldb-1.19/tmp/leveldb-1.19-cfgcmd.txt"
+  "3rdparty/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/stout/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/stout/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/libprocess/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/libprocess/src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "3rdparty/libprocess/src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "include/mesos/version.hpp"
+  "src/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/checks/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/cli/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/docker/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/examples/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/launcher/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/local/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/log/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/master/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/slave/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/slave/container_loggers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/slave/qos_controllers/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/slave/resource_estimators/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/slave/containerizer/mesos/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/usage/CMakeFiles/CMakeDirectoryInformation.cmake"
+  "src/tests/CMakeFiles/CMakeDirectoryInformation.cmake"
+  )
+
+# Dependency information for all targets:
+set(CMAKE_DEPEND_INFO_FILES
+  "CMakeFiles/make_bin_include_dir.dir/DependInfo.cmake"
+  "CMakeFiles/make_bin_src_dir.dir/DependInfo.cmake"
+  "CMakeFiles/make_bin_java_dir.dir/DependInfo.cmake"
+  "CMakeFiles/make_bin_jni_dir.dir/DependInfo.cmake"
+  "CMakeFiles/check.dir/DependInfo.cmake"
+  "CMakeFiles/tests.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/boost-1.53.0.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/concurrentqueue-1.0.0-beta.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/elfio-3.2.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/glog-0.3.3.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/picojson-1.3.0.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/nvml-352.79.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/http_parser-2.6.2.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/libevent-2.1.5-beta.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/googletest-1.8.0.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/protobuf-3.3.0.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/zookeeper-3.4.8.dir/DependInfo.cmake"
+  "3rdparty/CMakeFiles/leveldb-1.19.dir/DependInfo.cmake"
+  "3rdparty/stout/tests/CMakeFiles/stout-tests.dir/DependInfo.cmake"
+  "3rdparty/libprocess/src/CMakeFiles/process.dir/DependInfo.cmake"
+  "3rdparty/libprocess/src/tests/CMakeFiles/libprocess-tests.dir/DependInfo.cmake"
+  "3rdparty/libprocess/src/tests/CMakeFiles/test-linkee.dir/DependInfo.cmake"
+  "3rdparty/libprocess/src/tests/CMakeFiles/ssl-client.dir/DependInfo.cmake"
+  "3rdparty/libprocess/src/tests/CMakeFiles/benchmarks.dir/DependInfo.cmake"
+  "src/CMakeFiles/mesos-protobufs.dir/DependInfo.cmake"
+  "src/CMakeFiles/mesos.dir/DependInfo.cmake"
+  "src/checks/CMakeFiles/mesos-tcp-connect.dir/DependInfo.cmake"
+  "src/cli/CMakeFiles/mesos-execute.dir/DependInfo.cmake"
+  "src/docker/CMakeFiles/mesos-docker-executor.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testallocator.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testanonymous.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testauthentication.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testauthorizer.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testcontainer_logger.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/examplemodule.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testhook.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testhttpauthenticator.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testisolator.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testmastercontender.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testmasterdetector.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testqos_controller.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/testresource_estimator.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/balloon-executor.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/balloon-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/disk-full-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/docker-no-executor-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/dynamic-reservation-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/load-generator-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/long-lived-executor.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/long-lived-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/no-executor-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/persistent-volume-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/test-executor.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/test-framework.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/test-http-executor.dir/DependInfo.cmake"
+  "src/examples/CMakeFiles/test-http-framework.dir/DependInfo.cmake"
+  "src/launcher/CMakeFiles/mesos-default-executor.dir/DependInfo.cmake"
+  "src/launcher/CMakeFiles/mesos-executor.dir/DependInfo.cmake"
+  "src/launcher/CMakeFiles/mesos-fetcher.dir/DependInfo.cmake"
+  "src/local/CMakeFiles/mesos-local.dir/DependInfo.cmake"
+  "src/log/CMakeFiles/mesos-log.dir/DependInfo.cmake"
+  "src/master/CMakeFiles/mesos-master.dir/DependInfo.cmake"
+  "src/slave/CMakeFiles/mesos-agent.dir/DependInfo.cmake"
+  "src/slave/container_loggers/CMakeFiles/logrotate_container_logger.dir/DependInfo.cmake"
+  "src/slave/container_loggers/CMakeFiles/mesos-logrotate-logger.dir/DependInfo.cmake"
+  "src/slave/qos_controllers/CMakeFiles/load_qos_controller.dir/DependInfo.cmake"
+  "src/slave/resource_estimators/CMakeFiles/fixed_resource_estimator.dir/DependInfo.cmake"
+  "src/slave/containerizer/mesos/CMakeFiles/mesos-containerizer.dir/DependInfo.cmake"
+  "src/slave/containerizer/mesos/CMakeFiles/mesos-io-switchboard.dir/DependInfo.cmake"
+  "src/slave/containerizer/mesos/CMakeFiles/mesos-cni-port-mapper.dir/DependInfo.cmake"
+  "src/usage/CMakeFiles/mesos-usage.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/mesos-tests.dir/DependInfo.cmake"
+  "src/tests/CMakeFiles/test-helper.dir/DependInfo.cmake"
+  )